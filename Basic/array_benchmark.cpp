@@ -1,40 +1,73 @@
 #include <bits/stdc++.h>
-#include <x86intrin.h>
+#include "bench.hpp"
 using namespace std;
-using namespace std::chrono;
+
+// Vektör toplamının maliyetini bench.hpp ile ölçüyoruz.
+// İlk sürüm tek ve soğuk bir rdtsc ölçümü yapıp başka bir döngünün
+// süresini "overhead" diye çıkarıyordu; burada:
+//   - soğuk ilk çağrı ayrı yazdırılır (sayfalar, cache, TLB ısınmamış)
+//   - ısınmış ölçüm harness ile tekrarlanır, medyan/MAD/yüzdelikler verilir
+//   - indeks döngüsü çıkarılmaz, kendi başına ölçülür
+//
+// Donanım sayaçları (perf_event_open) da okunur; açılamazsa uyarı basılır.
+//
+// g++ -std=c++20 -O2 array_benchmark.cpp -o array_benchmark
 
 int main() {
     const int N = 10000000;
     vector<int> a(N, 1);
 
-    auto start = high_resolution_clock::now();
-    unsigned long long start_c = __rdtsc();
+    print_bench_environment(true);
 
-    long long sum = 0;
-    for(int i = 0; i < N; i++) {
-        sum += a[i];
+    // Soğuk tek ölçüm: vektör yeni doldurulmuş olsa da 40 MB cache'e sığmaz.
+    long long cold_sum = 0;
+    uint64_t t0 = tsc_begin();
+    for (int i = 0; i < N; i++) {
+        cold_sum += a[i];
     }
-    unsigned long long end_c = __rdtsc();
-    auto end = high_resolution_clock::now();
-    double ms = duration<double, milli>(end - start).count();
+    do_not_optimize(cold_sum);
+    uint64_t t1 = tsc_end();
+    printf("cold single run: %.0f ticks, %.2f ms, sum = %lld\n\n",
+           double(t1 - t0), (t1 - t0) / tsc_ghz() / 1e6, cold_sum);
 
-    unsigned long long loop_start = _rdtsc();
+    BenchOptions opt;
+    opt.items = N;
+    opt.counters = true;
+    print_bench_header();
 
-    long long s = 0;
-    for(int i = 0; i < N; i++) {
-        s += i;
-    }
-
-    unsigned long long loop_end = _rdtsc();
+    long long sum = 0;
+    print_bench(run_benchmark("sum of vector<int> (40 MB)", [&] {
+        long long s = 0;
+        for (int i = 0; i < N; i++) {
+            s += a[i];
+        }
+        sum = s;
+        do_not_optimize(sum);
+    }, opt));
 
+    // Bellek okumayan aynı döngü. n her seferinde "bilinmeyen" yapılır,
+    // yoksa derleyici toplamı N*(N-1)/2 formülüne çevirir.
+    print_bench(run_benchmark("sum of indices (no loads)", [&] {
+        int n = N;
+        do_not_optimize(n);
+        long long s = 0;
+        for (int i = 0; i < n; i++) {
+            s += i;
+        }
+        do_not_optimize(s);
+    }, opt));
 
-    unsigned long long real_cycles = end_c - start_c;
-    unsigned long long loop_overhead = loop_end - loop_start;
-    unsigned long long pure_cycles = real_cycles - loop_overhead;
+    // Cache'e sığan küçük dizi: aynı döngü bellek yerine L1/L2'den beslenir.
+    const int SMALL = 4096;
+    BenchOptions small_opt;
+    small_opt.items = SMALL;
+    print_bench(run_benchmark("sum of vector<int> (16 KB)", [&] {
+        long long s = 0;
+        for (int i = 0; i < SMALL; i++) {
+            s += a[i];
+        }
+        do_not_optimize(s);
+    }, small_opt));
 
-    cout << "Sum = " << sum << "\n";
-    cout << "Total time: " << ms << " ms\n";
-    cout << "Total cycles: " << real_cycles << "\n";
-    cout << "Loop overhead: " << loop_overhead << "\n";
-    cout << "Pure compute+memory cycles: " << pure_cycles << "\n";
-}
\ No newline at end of file
+    printf("\nSum = %lld\n", sum);
+}
@@ -0,0 +1,352 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <time.h>
+#include <cpuid.h>
+#include <x86intrin.h>
+
+#include "perf_counters.hpp"
+
+/*
+ * Mikrobenchmark harness'ı
+ *
+ * array_benchmark.cpp'nin ilk hali __rdtsc()'yi çıplak kullanıyordu:
+ *   - rdtsc serileştirici değildir; CPU ondan önceki/sonraki komutları
+ *     yeniden sıralayıp ölçülen bölgenin içine ya da dışına kaydırabilir.
+ *   - "Overhead" olarak başka bir döngünün süresi çıkarılıyordu, o döngü
+ *     daha uzun sürerse sonuç negatif olur.
+ *   - Tek ve soğuk (cache, TLB, branch predictor, CPU frekansı ısınmamış)
+ *     bir ölçüm yapılıyordu.
+ *
+ * Burada:
+ *   tsc_begin()  → lfence; rdtsc; lfence  (önceki komutlar bitmeden
+ *                  okunmaz, sonraki komutlar okumadan önce başlamaz)
+ *   tsc_end()    → rdtscp; lfence         (rdtscp önceki komutların
+ *                  bitmesini bekler, lfence sonrakileri tutar)
+ *   tsc_ghz()    → TSC frekansı CLOCK_MONOTONIC'e karşı ölçülür. TSC
+ *                  çekirdek frekansı değil sabit bir referans saattir
+ *                  (invariant TSC), yani "cycle" = TSC tick'i.
+ *   run_benchmark()
+ *     1) ısınma (warmup_ms boyunca fonksiyon çalıştırılır)
+ *     2) batch: fonksiyon tek ölçüm için çok kısaysa, bir örnek en az
+ *        min_sample_ticks sürecek kadar art arda çağrılır
+ *     3) örnekler bloklar halinde toplanır; medyan iki blok arasında
+ *        rel_tolerance'tan az değişince ve MAD/medyan max_rel_mad'in
+ *        altına inince durulur (ya da max_samples / max_ms dolunca)
+ *     4) ölçüm bölgesinin kendi maliyeti (boş tsc_begin/tsc_end) bir kez
+ *        ölçülür ve her örnekten çıkarılır, 0'ın altına inemez
+ *   Sonuç: medyan, MAD (median absolute deviation), min, p5..p99, max.
+ *   Ortalama yerine medyan: kesmeler ve context switch'ler birkaç çok uzun
+ *   örnek üretir, ortalamayı kaydırır ama medyanı etkilemez.
+ *
+ * do_not_optimize(x) / clobber_memory(): derleyicinin sonucu kullanılmayan
+ * hesabı silmesini ya da döngü dışına taşımasını engeller.
+ *
+ * BenchOptions::counters = true ile her örnek perf_event_open sayaçlarıyla
+ * (perf_counters.hpp) sarılır ve çağrı başına medyan sayaçlar ile IPC
+ * raporlanır. Sayaçlar açılamazsa bir kez uyarı basılır, ölçüm devam eder.
+ *
+ * Sadece x86-64, GCC/Clang.
+ */
+
+// ------------------------------------------------------------------
+// Derleyici bariyerleri
+// ------------------------------------------------------------------
+
+// Değer bir register'da ya da bellekte "kullanılmış" sayılır.
+template <typename T>
+inline void do_not_optimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Değer okunmuş ve değiştirilmiş sayılır; derleyici önceki değerini bildiğini
+// varsayamaz (örn. sabit bir girdiyi her iterasyonda yeniden hesaplatmak için).
+template <typename T>
+inline void do_not_optimize(T& value) {
+#if defined(__clang__)
+    asm volatile("" : "+r,m"(value) : : "memory");
+#else
+    asm volatile("" : "+m,r"(value) : : "memory");
+#endif
+}
+
+// Bütün bekleyen bellek yazmaları yapılmış sayılır.
+inline void clobber_memory() {
+    asm volatile("" : : : "memory");
+}
+
+// ------------------------------------------------------------------
+// TSC
+// ------------------------------------------------------------------
+
+inline std::uint64_t tsc_begin() {
+    _mm_lfence();
+    std::uint64_t t = __rdtsc();
+    _mm_lfence();
+    return t;
+}
+
+inline std::uint64_t tsc_end() {
+    unsigned aux;
+    std::uint64_t t = __rdtscp(&aux);
+    _mm_lfence();
+    return t;
+}
+
+inline double monotonic_ns() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// CPUID 0x80000007, EDX bit 8: TSC frekansı güç durumlarından bağımsız.
+inline bool tsc_invariant() {
+    unsigned a, b, c, d;
+    if (!__get_cpuid(0x80000007, &a, &b, &c, &d)) {
+        return false;
+    }
+    return d & (1u << 8);
+}
+
+// TSC tick / ns. Beş kez 20 ms'lik pencere ölçülür, medyan alınır.
+// İlk çağrıda hesaplanır, sonra saklanır.
+inline double tsc_ghz() {
+    static const double ghz = [] {
+        std::vector<double> r;
+        for (int i = 0; i < 5; i++) {
+            double n0 = monotonic_ns();
+            std::uint64_t t0 = tsc_begin();
+            while (monotonic_ns() - n0 < 20e6) {
+            }
+            double n1 = monotonic_ns();
+            std::uint64_t t1 = tsc_end();
+            r.push_back((t1 - t0) / (n1 - n0));
+        }
+        std::sort(r.begin(), r.end());
+        return r[r.size() / 2];
+    }();
+    return ghz;
+}
+
+// Boş ölçüm bölgesinin medyan maliyeti (tick).
+inline double tsc_overhead() {
+    static const double overhead = [] {
+        std::vector<std::uint64_t> v(1000);
+        for (auto& x : v) {
+            std::uint64_t t0 = tsc_begin();
+            std::uint64_t t1 = tsc_end();
+            x = t1 - t0;
+        }
+        std::sort(v.begin(), v.end());
+        return double(v[v.size() / 2]);
+    }();
+    return overhead;
+}
+
+// ------------------------------------------------------------------
+// İstatistik
+// ------------------------------------------------------------------
+
+// Sıralı dizide q (0..1) yüzdeliği, doğrusal interpolasyon ile.
+inline double percentile(const std::vector<double>& sorted, double q) {
+    if (sorted.empty()) return 0.0;
+    double pos = q * (sorted.size() - 1);
+    std::size_t lo = static_cast<std::size_t>(pos);
+    std::size_t hi = std::min(lo + 1, sorted.size() - 1);
+    return sorted[lo] + (pos - lo) * (sorted[hi] - sorted[lo]);
+}
+
+inline double median_of(std::vector<double> v) {
+    std::sort(v.begin(), v.end());
+    return percentile(v, 0.5);
+}
+
+// Median absolute deviation: medyandan mutlak sapmaların medyanı.
+// Standart sapmanın aksine birkaç aykırı örnekten etkilenmez.
+inline double mad_of(const std::vector<double>& v, double median) {
+    std::vector<double> dev(v.size());
+    for (std::size_t i = 0; i < v.size(); i++) {
+        dev[i] = std::fabs(v[i] - median);
+    }
+    return median_of(dev);
+}
+
+// ------------------------------------------------------------------
+// Harness
+// ------------------------------------------------------------------
+
+struct BenchOptions {
+    double warmup_ms = 50;              // ısınma süresi
+    double min_sample_ticks = 20000;    // tek örneğin en kısa süresi (batch buna göre seçilir)
+    int block = 16;                     // kararlılık kontrolleri arası örnek sayısı
+    int min_samples = 32;
+    int max_samples = 2000;
+    double max_ms = 2000;               // bir benchmark için üst süre sınırı
+    double rel_tolerance = 0.01;        // iki blok arası medyan değişimi
+    double max_rel_mad = 0.05;          // MAD / medyan üst sınırı
+    double items = 1;                   // fonksiyonun bir çağrısındaki iş birimi (eleman, byte ...)
+    bool counters = false;              // donanım sayaçlarını da oku
+};
+
+struct BenchResult {
+    std::string name;
+    std::vector<double> samples;   // çağrı başına tick, sıralı
+    std::uint64_t batch = 1;       // örnek başına çağrı sayısı
+    bool stable = false;           // kararlılık kriteri sağlandı mı
+    double items = 1;
+
+    double median = 0, mad = 0, min = 0, max = 0;
+    double p5 = 0, p25 = 0, p75 = 0, p95 = 0, p99 = 0;
+
+    // Çağrı başına medyan sayaç değerleri (counters seçildiyse).
+    double counter[PerfCounters::EVENT_COUNT] = {};
+    bool counter_valid[PerfCounters::EVENT_COUNT] = {};
+    bool multiplexed = false;
+
+    double median_ns() const { return median / tsc_ghz(); }
+    double ipc() const {
+        bool ok = counter_valid[PerfCounters::Cycles] && counter_valid[PerfCounters::Instructions] &&
+                  counter[PerfCounters::Cycles] > 0;
+        return ok ? counter[PerfCounters::Instructions] / counter[PerfCounters::Cycles] : 0.0;
+    }
+    double ticks_per_item() const { return median / items; }
+    double ns_per_item() const { return median_ns() / items; }
+};
+
+// Program boyunca tek sayaç seti; kullanılamıyorsa neden bir kez yazdırılır.
+inline PerfCounters* bench_perf_counters() {
+    static PerfCounters pc;
+    static bool noticed = false;
+    if (!noticed && !pc.notice().empty()) {
+        std::printf("note: %s\n", pc.notice().c_str());
+    }
+    noticed = true;
+    return pc.available() ? &pc : nullptr;
+}
+
+template <typename F>
+BenchResult run_benchmark(const std::string& name, F&& fn, const BenchOptions& opt = {}) {
+    BenchResult r;
+    r.name = name;
+    r.items = opt.items;
+    const double overhead = tsc_overhead();
+
+    // 1) Isınma: cache'ler, TLB, branch predictor ve CPU frekansı otursun.
+    double w0 = monotonic_ns();
+    do {
+        fn();
+        clobber_memory();
+    } while (monotonic_ns() - w0 < opt.warmup_ms * 1e6);
+
+    // 2) Batch: bir örnek en az min_sample_ticks sürsün.
+    std::uint64_t t0 = tsc_begin();
+    fn();
+    clobber_memory();
+    double one = double(tsc_end() - t0) - overhead;
+    if (one < opt.min_sample_ticks) {
+        r.batch = static_cast<std::uint64_t>(opt.min_sample_ticks / std::max(one, 1.0)) + 1;
+    }
+
+    // 3) Örnekler: medyan ve MAD oturana kadar. Sayaçlar açık ise TSC
+    // penceresinin dışında başlatılıp durdurulur (ioctl süreye girmez).
+    PerfCounters* pc = opt.counters ? bench_perf_counters() : nullptr;
+    std::vector<double> counts[PerfCounters::EVENT_COUNT];
+    double start = monotonic_ns();
+    double prev_median = -1;
+    while (true) {
+        for (int i = 0; i < opt.block; i++) {
+            if (pc) pc->start();
+            std::uint64_t a = tsc_begin();
+            for (std::uint64_t k = 0; k < r.batch; k++) {
+                fn();
+                clobber_memory();
+            }
+            std::uint64_t b = tsc_end();
+            if (pc) {
+                PerfCounters::Sample cs = pc->stop();
+                r.multiplexed |= cs.multiplexed;
+                for (int e = 0; e < PerfCounters::EVENT_COUNT; e++) {
+                    if (cs.valid[e]) counts[e].push_back(cs.value[e] / r.batch);
+                }
+            }
+            double ticks = std::max(0.0, double(b - a) - overhead);
+            r.samples.push_back(ticks / r.batch);
+        }
+        int n = static_cast<int>(r.samples.size());
+        double med = median_of(r.samples);
+        if (n >= opt.min_samples && prev_median > 0) {
+            double change = std::fabs(med - prev_median) / std::max(med, 1e-9);
+            double rel_mad = mad_of(r.samples, med) / std::max(med, 1e-9);
+            if (change < opt.rel_tolerance && rel_mad < opt.max_rel_mad) {
+                r.stable = true;
+                break;
+            }
+        }
+        if (n >= opt.max_samples || monotonic_ns() - start > opt.max_ms * 1e6) {
+            break;
+        }
+        prev_median = med;
+    }
+
+    std::sort(r.samples.begin(), r.samples.end());
+    const auto& s = r.samples;
+    r.median = percentile(s, 0.50);
+    r.mad = mad_of(s, r.median);
+    r.min = s.front();
+    r.max = s.back();
+    r.p5 = percentile(s, 0.05);
+    r.p25 = percentile(s, 0.25);
+    r.p75 = percentile(s, 0.75);
+    r.p95 = percentile(s, 0.95);
+    r.p99 = percentile(s, 0.99);
+    for (int e = 0; e < PerfCounters::EVENT_COUNT; e++) {
+        if (!counts[e].empty()) {
+            r.counter[e] = median_of(counts[e]);
+            r.counter_valid[e] = true;
+        }
+    }
+    return r;
+}
+
+// counters = true ise sayaçlar burada açılır, kullanılamıyorsa neden tablodan
+// önce yazdırılır.
+inline void print_bench_environment(bool counters = false) {
+    std::printf("TSC %.3f GHz (calibrated against CLOCK_MONOTONIC), %s, timing overhead %.0f ticks\n",
+                tsc_ghz(), tsc_invariant() ? "invariant" : "NOT invariant, results may drift",
+                tsc_overhead());
+    if (counters && bench_perf_counters()) {
+        std::printf("hardware counters: on\n");
+    }
+}
+
+inline void print_bench_header() {
+    std::printf("%-28s %12s %10s %7s %12s %12s %12s %12s %8s %6s\n", "benchmark", "median ns", "ticks", "MAD%",
+                "min ticks", "p5", "p95", "p99", "samples", "");
+}
+
+inline void print_bench(const BenchResult& r) {
+    std::printf("%-28s %12.1f %10.0f %6.2f%% %12.0f %12.0f %12.0f %12.0f %8zu %6s\n", r.name.c_str(),
+                r.median_ns(), r.median, 100.0 * r.mad / std::max(r.median, 1e-9), r.min, r.p5, r.p95, r.p99,
+                r.samples.size(), r.stable ? "" : "noisy");
+    if (r.items != 1) {
+        std::printf("%-28s %12.3f ns/item, %.3f ticks/item\n", "", r.ns_per_item(), r.ticks_per_item());
+    }
+    // Sayaçlar: items verilmişse iş birimi başına, yoksa çağrı başına.
+    bool any = false;
+    for (bool v : r.counter_valid) any |= v;
+    if (any) {
+        std::printf("%-28s %12s", "", r.items != 1 ? "per item:" : "per call:");
+        for (int e = 0; e < PerfCounters::EVENT_COUNT; e++) {
+            if (r.counter_valid[e]) {
+                std::printf(" %s %.3f", PerfCounters::name(e), r.counter[e] / r.items);
+            }
+        }
+        if (r.ipc() > 0) std::printf(", IPC %.2f", r.ipc());
+        std::printf("%s\n", r.multiplexed ? " (multiplexed, scaled)" : "");
+    }
+}
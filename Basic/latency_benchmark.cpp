@@ -0,0 +1,230 @@
+#include <bits/stdc++.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "bench.hpp"
+using namespace std;
+
+// Bellek hiyerarşisinin her seviyesi için load-to-use gecikmesi.
+// array_benchmark.cpp diziyi sırayla okur; donanım prefetcher'ı bir sonraki
+// line'ı önceden getirdiği için orada görülen bant genişliğidir, gecikme
+// değil. Burada her load bir öncekinin sonucuna bağlıdır (pointer chasing):
+//
+//     p = p->next;   // adres, önceki load bitmeden bilinmez
+//
+// Çalışma kümesi 64 byte'lık line'lardan oluşur ve line'lar rastgele bir
+// permütasyonla tek bir halka olarak bağlanır, böylece prefetcher bir
+// sonraki adresi tahmin edemez. Küme boyutu 4 KB'tan 1 GB'a kadar ikişer
+// katlanır; boyut bir cache seviyesini aştığında gecikme bir basamak atlar.
+//
+// Aynı ölçüm iki sayfa boyutuyla yapılır:
+//   4K  → madvise(MADV_NOHUGEPAGE); küme dTLB'nin kapsadığı alanı (TLB reach)
+//         aşınca her load'a bir de sayfa tablosu yürüyüşü eklenir
+//   2M  → önce MAP_HUGETLB (vm.nr_hugepages ayrılmış olmalı), olmazsa
+//         madvise(MADV_HUGEPAGE) ile transparent huge page; gerçekten kaç
+//         byte'ın 2 MB sayfaya oturduğu /proc/self/smaps_rollup'tan okunur
+// 4K/2M oranı 1'den belirgin şekilde büyüdüğü yer 4K sayfalı TLB reach'tir.
+//
+// HFTBTree için okuma: bir arama ağaç derinliği kadar bağımlı load yapar,
+// yani maliyeti ≈ derinlik × düğümlerin bulunduğu seviyenin gecikmesi.
+// Düğümlerin sıcak kısmının L2'ye sığması ve 64 MB'lık arena'nın 2 MB
+// sayfalarla ayrılması bu tablodan bakılarak karar verilecek şeylerdir.
+//
+// Tick sütunu TSC tick'idir; çekirdek saati TSC'den farklıysa cycle değildir.
+//
+// g++ -std=c++20 -O2 latency_benchmark.cpp -o latency_benchmark
+// ./latency_benchmark [max_MB]
+
+const size_t LINE = 64;
+const size_t HUGE_PAGE = 2 << 20;
+const int HOPS = 1024;   // fonksiyon çağrısı başına adım
+
+struct Line {
+    Line* next;
+    char pad[LINE - sizeof(Line*)];
+};
+static_assert(sizeof(Line) == LINE);
+
+// /proc/self/smaps_rollup'taki AnonHugePages (byte). THP kapsamını ölçmek için.
+static size_t anon_huge_bytes() {
+    ifstream in("/proc/self/smaps_rollup");
+    string key;
+    size_t kb;
+    while (in >> key) {
+        if (key == "AnonHugePages:" && in >> kb) return kb * 1024;
+        in.ignore(numeric_limits<streamsize>::max(), '\n');
+    }
+    return 0;
+}
+
+// mmap ile ayrılan bölge; huge = true ise 2 MB sayfalar denenir.
+struct Region {
+    char* mapping = nullptr;   // munmap edilecek adres
+    size_t mapped = 0;
+    char* data = nullptr;      // kullanılacak (gerekirse 2 MB hizalı) adres
+    const char* how = "";
+
+    Region(size_t bytes, bool huge) {
+        if (!huge) {
+            mapped = bytes;
+            mapping = static_cast<char*>(mmap(nullptr, mapped, PROT_READ | PROT_WRITE,
+                                              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+            if (mapping == MAP_FAILED) throw runtime_error("mmap failed");
+            madvise(mapping, mapped, MADV_NOHUGEPAGE);
+            data = mapping;
+            how = "4K";
+            return;
+        }
+        size_t rounded = (bytes + HUGE_PAGE - 1) / HUGE_PAGE * HUGE_PAGE;
+        void* p = mmap(nullptr, rounded, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (p != MAP_FAILED) {
+            mapping = data = static_cast<char*>(p);
+            mapped = rounded;
+            how = "hugetlbfs";
+            return;
+        }
+        // THP: 2 MB hizalı bir adres için fazladan ayırıp başı kaydırılır.
+        mapped = rounded + HUGE_PAGE;
+        mapping = static_cast<char*>(mmap(nullptr, mapped, PROT_READ | PROT_WRITE,
+                                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+        if (mapping == MAP_FAILED) throw runtime_error("mmap failed");
+        uintptr_t aligned = (reinterpret_cast<uintptr_t>(mapping) + HUGE_PAGE - 1) & ~(HUGE_PAGE - 1);
+        data = reinterpret_cast<char*>(aligned);
+        madvise(data, rounded, MADV_HUGEPAGE);
+        how = "THP";
+    }
+
+    ~Region() { munmap(mapping, mapped); }
+    Region(const Region&) = delete;
+    Region& operator=(const Region&) = delete;
+};
+
+// Küme içindeki line'ları rastgele sırayla tek bir halkaya bağlar.
+static Line* build_chain(char* base, size_t bytes, mt19937_64& rng) {
+    size_t n = bytes / LINE;
+    vector<uint32_t> order(n);
+    iota(order.begin(), order.end(), 0);
+    shuffle(order.begin(), order.end(), rng);
+    Line* lines = reinterpret_cast<Line*>(base);
+    for (size_t i = 0; i < n; i++) {
+        lines[order[i]].next = &lines[order[(i + 1) % n]];
+    }
+    return &lines[order[0]];
+}
+
+struct Point {
+    double ns = 0, ticks = 0;
+    bool stable = false;
+};
+
+static Point chase(Line* head, size_t lines) {
+    Line* p = head;
+    // Isınma: halkayı (en fazla 1M adım) bir kez dolaş, cache ve TLB dolsun.
+    for (size_t i = 0; i < min<size_t>(lines, 1 << 20); i++) p = p->next;
+
+    BenchOptions opt;
+    opt.items = HOPS;
+    opt.warmup_ms = 20;
+    opt.max_ms = 300;
+    // p çağrılar arasında korunur: her çağrı halkada kaldığı yerden devam
+    // eder, aynı ilk HOPS line'ı tekrar tekrar (cache'ten) okumaz.
+    BenchResult r = run_benchmark("chase", [&] {
+        Line* q = p;
+        for (int i = 0; i < HOPS; i++) q = q->next;
+        p = q;
+        do_not_optimize(p);
+    }, opt);
+    return {r.ns_per_item(), r.ticks_per_item(), r.stable};
+}
+
+static string human(size_t bytes) {
+    char buf[32];
+    if (bytes >= (1 << 30)) snprintf(buf, sizeof buf, "%zu GB", bytes >> 30);
+    else if (bytes >= (1 << 20)) snprintf(buf, sizeof buf, "%zu MB", bytes >> 20);
+    else snprintf(buf, sizeof buf, "%zu KB", bytes >> 10);
+    return buf;
+}
+
+int main(int argc, char** argv) {
+    long max_mb = argc > 1 ? atol(argv[1]) : 1024;
+    if (max_mb < 1) {   // en küçük küme 4 KB; tablo en az bir satır olmalı
+        fprintf(stderr, "usage: %s [max_MB >= 1]\n", argv[0]);
+        return 1;
+    }
+    size_t max_bytes = size_t(max_mb) << 20;
+
+    print_bench_environment();
+    struct Level { const char* name; long bytes; };
+    vector<Level> levels = {{"L1d", sysconf(_SC_LEVEL1_DCACHE_SIZE)},
+                            {"L2", sysconf(_SC_LEVEL2_CACHE_SIZE)},
+                            {"L3", sysconf(_SC_LEVEL3_CACHE_SIZE)}};
+    for (const Level& l : levels) {
+        printf("%s %s  ", l.name, l.bytes > 0 ? human(l.bytes).c_str() : "?");
+    }
+    printf("(sysconf)\n");
+
+    // En büyük küme bir kez ayrılır; her boyut onun başını kullanır.
+    // Böylece 4K ve 2M bölgeleri boyutlar arasında aynı kalır.
+    Region small(max_bytes, false), huge(max_bytes, true);
+    size_t thp_before = anon_huge_bytes();
+    memset(small.data, 0, max_bytes);
+    memset(huge.data, 0, max_bytes);
+    double huge_coverage = strcmp(huge.how, "THP") == 0
+                               ? double(anon_huge_bytes() - thp_before) / max_bytes : 1.0;
+    printf("2M pages via %s, %.0f%% of the region backed by huge pages\n", huge.how,
+           100 * min(1.0, huge_coverage));
+    if (huge_coverage < 0.5) {
+        printf("warning: few huge pages granted; the 4K/2M column does not isolate TLB cost\n");
+    }
+
+    printf("\n%8s %9s %8s %9s %8s %7s   %s\n", "size", "4K ns", "ticks", "2M ns", "ticks", "4K/2M", "");
+    mt19937_64 rng(42);
+    vector<size_t> sizes;
+    vector<Point> p4, p2;
+    size_t level = 0;
+    bool tlb_marked = false;
+    for (size_t bytes = 4 << 10; bytes <= max_bytes; bytes *= 2) {
+        size_t lines = bytes / LINE;
+        Point a = chase(build_chain(small.data, bytes, rng), lines);
+        Point b = chase(build_chain(huge.data, bytes, rng), lines);
+        sizes.push_back(bytes);
+        p4.push_back(a);
+        p2.push_back(b);
+
+        // Not sütunu: aşılan cache seviyesi, gecikme basamağı, TLB reach.
+        string note;
+        while (level < levels.size() && levels[level].bytes > 0 && bytes > size_t(levels[level].bytes)) {
+            note += string("> ") + levels[level].name + "  ";
+            level++;
+        }
+        if (p4.size() > 1 && a.ns > 1.3 * p4[p4.size() - 2].ns) {
+            note += "step +" + to_string(int(100 * (a.ns / p4[p4.size() - 2].ns - 1))) + "%  ";
+        }
+        double ratio = a.ns / b.ns;
+        if (!tlb_marked && huge_coverage >= 0.5 && ratio > 1.15) {
+            note += "4K dTLB reach exceeded  ";
+            tlb_marked = true;
+        }
+        printf("%8s %9.2f %8.1f %9.2f %8.1f %7.2f   %s%s\n", human(bytes).c_str(), a.ns, a.ticks, b.ns,
+               b.ticks, ratio, note.c_str(), a.stable && b.stable ? "" : "~");
+    }
+    printf("~ = not stable within the time limit\n");
+
+    // Seviye başına plato: kapasitenin yarısına kadar olan en büyük küme
+    // (2M sayfalarla, TLB etkisi en az). DRAM için en büyük küme.
+    printf("\n=== load-to-use latency (2M pages) ===\n");
+    long prev = 0;
+    for (const Level& l : levels) {
+        if (l.bytes <= 0) continue;
+        for (size_t i = sizes.size(); i-- > 0;) {
+            if (sizes[i] <= size_t(l.bytes) / 2 && sizes[i] > size_t(prev)) {
+                printf("%-5s %7.2f ns  (%s working set)\n", l.name, p2[i].ns, human(sizes[i]).c_str());
+                break;
+            }
+        }
+        prev = l.bytes;
+    }
+    if (prev > 0 && sizes.back() > size_t(prev)) {
+        printf("%-5s %7.2f ns  (%s working set)\n", "DRAM", p2.back().ns, human(sizes.back()).c_str());
+    }
+}
@@ -0,0 +1,303 @@
+#include <bits/stdc++.h>
+#include "bench.hpp"
+#include "soa_vector.hpp"
+using namespace std;
+
+// AoS, SoA ve AoSoA veri yerleşimlerinin karşılaştırması.
+// array_benchmark.cpp düz int'leri toplar; piyasa verisi ise kayıtlardan
+// oluşur ve çoğu döngü on alandan sadece ikisine bakar. Aynı veri üç
+// şekilde tutulur:
+//   AoS     vector<Quote>              (64 byte'lık kayıtlar)
+//   SoA     soa_vector<...>            (her alan ayrı dizi)
+//   AoSoA   aosoa_vector<16, ...>      (16 kayıtlık bloklar, blok içi SoA)
+// SoA bir de soa_ref proxy'si üzerinden ölçülür (SoA proxy); düz sütun
+// pointer'larıyla arasındaki fark proxy'nin maliyetidir.
+//
+// İşler:
+//   scan 2/10     bütün kayıtlarda ask_px - bid_px toplamı (alt küme tarama)
+//   update 10/10  her kaydın bütün alanları güncellenir (tam kayıt)
+//   random 10/10  rastgele kayıtların bütün alanları okunur
+//   random 2/10   rastgele kayıtların bid_px/ask_px'i okunur
+//
+// Beklenen: taramada SoA/AoSoA, AoS'un getirdiği byte'ların 1/4'ünü okur
+// ve vektörleşir; rastgele tam kayıt okumada AoS tek cache line'la, SoA
+// on ayrı line'la (on ayrı TLB girişiyle) öder, AoSoA ikisinin arasında
+// kalır. Tam kayıt güncellemede üçü de bütün byte'ları dolaşır.
+//
+// Her işin sonucu önce üç yerleşimde bir kez hesaplanıp karşılaştırılır.
+//
+// g++ -std=c++20 -O3 -march=native layout_benchmark.cpp -o layout_benchmark
+// ./layout_benchmark [records]
+
+struct Quote {
+    int64_t ts;
+    int64_t seq;
+    int64_t bid_px;       // fiyatlar tick cinsinden tam sayı
+    int64_t ask_px;
+    int64_t last_px;
+    int32_t instrument;
+    int32_t venue;
+    int32_t bid_qty;
+    int32_t ask_qty;
+    int32_t level;
+};
+static_assert(sizeof(Quote) == 64);
+
+enum { TS, SEQ, BID_PX, ASK_PX, LAST_PX, INSTRUMENT, VENUE, BID_QTY, ASK_QTY, LEVEL };
+
+using QuoteSoA = soa_vector<int64_t, int64_t, int64_t, int64_t, int64_t, int32_t, int32_t, int32_t, int32_t, int32_t>;
+using QuoteAoSoA =
+    aosoa_vector<16, int64_t, int64_t, int64_t, int64_t, int64_t, int32_t, int32_t, int32_t, int32_t, int32_t>;
+
+const int RANDOM_LOOKUPS = 1 << 16;
+
+// ---- AoS ----
+static int64_t scan_aos(const vector<Quote>& q) {
+    int64_t s = 0;
+    for (const Quote& x : q) s += x.ask_px - x.bid_px;
+    return s;
+}
+
+static void update_one(Quote& x) {
+    x.ts += 1000 + (x.instrument & 7);
+    x.seq += 1 + (x.venue & 1);
+    x.bid_px += 1;
+    x.ask_px += 1;
+    x.last_px = (x.bid_px + x.ask_px) >> 1;
+    x.bid_qty += 1;
+    x.ask_qty -= 1;
+    x.level = (x.level + 1) & 15;
+}
+
+static void update_aos(vector<Quote>& q) {
+    for (Quote& x : q) update_one(x);
+}
+
+static int64_t sum_fields(const Quote& x) {
+    return x.ts + x.seq + x.bid_px + x.ask_px + x.last_px + x.instrument + x.venue + x.bid_qty + x.ask_qty +
+           x.level;
+}
+
+static int64_t random_aos(const vector<Quote>& q, const vector<uint32_t>& idx) {
+    int64_t s = 0;
+    for (uint32_t i : idx) s += sum_fields(q[i]);
+    return s;
+}
+
+static int64_t random2_aos(const vector<Quote>& q, const vector<uint32_t>& idx) {
+    int64_t s = 0;
+    for (uint32_t i : idx) s += q[i].ask_px - q[i].bid_px;
+    return s;
+}
+
+// ---- SoA, düz sütun pointer'larıyla ----
+static int64_t scan_soa(const QuoteSoA& q) {
+    const int64_t* bid = q.data<BID_PX>();
+    const int64_t* ask = q.data<ASK_PX>();
+    size_t n = q.size();
+    int64_t s = 0;
+    for (size_t i = 0; i < n; i++) s += ask[i] - bid[i];
+    return s;
+}
+
+// Sütunlar üzerinde güncelleme; SoA için bütün dizi, AoSoA için bir blok.
+// __restrict parametrelerde: GCC yerel pointer değişkenlerindeki
+// __restrict'i dikkate almaz, on sütun için çalışma anında aliasing
+// kontrolü üretmek yerine döngüyü vektörleştirmekten vazgeçer.
+static void update_columns(int64_t* __restrict ts, int64_t* __restrict seq, int64_t* __restrict bid,
+                           int64_t* __restrict ask, int64_t* __restrict last, const int32_t* __restrict ins,
+                           const int32_t* __restrict venue, int32_t* __restrict bq, int32_t* __restrict aq,
+                           int32_t* __restrict level, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        ts[i] += 1000 + (ins[i] & 7);
+        seq[i] += 1 + (venue[i] & 1);
+        bid[i] += 1;
+        ask[i] += 1;
+        last[i] = (bid[i] + ask[i]) >> 1;
+        bq[i] += 1;
+        aq[i] -= 1;
+        level[i] = (level[i] + 1) & 15;
+    }
+}
+
+static void update_soa(QuoteSoA& q) {
+    update_columns(q.data<TS>(), q.data<SEQ>(), q.data<BID_PX>(), q.data<ASK_PX>(), q.data<LAST_PX>(),
+                   q.data<INSTRUMENT>(), q.data<VENUE>(), q.data<BID_QTY>(), q.data<ASK_QTY>(), q.data<LEVEL>(),
+                   q.size());
+}
+
+// Proxy'den tam kayıt: structured binding ile alanlara referans alınır.
+template <typename Ref>
+static int64_t sum_fields(Ref r) {
+    auto [ts, seq, bid, ask, last, ins, venue, bq, aq, level] = r;
+    return ts + seq + bid + ask + last + ins + venue + bq + aq + level;
+}
+
+template <typename Layout>
+static int64_t random_proxy(const Layout& q, const vector<uint32_t>& idx) {
+    int64_t s = 0;
+    for (uint32_t i : idx) s += sum_fields(q[i]);
+    return s;
+}
+
+template <typename Layout>
+static int64_t random2_proxy(const Layout& q, const vector<uint32_t>& idx) {
+    int64_t s = 0;
+    for (uint32_t i : idx) s += q[i].template get<ASK_PX>() - q[i].template get<BID_PX>();
+    return s;
+}
+
+// ---- SoA, proxy üzerinden ----
+static int64_t scan_soa_proxy(const QuoteSoA& q) {
+    int64_t s = 0;
+    for (auto r : q) s += r.get<ASK_PX>() - r.get<BID_PX>();
+    return s;
+}
+
+static void update_soa_proxy(QuoteSoA& q) {
+    for (auto r : q) {
+        auto [ts, seq, bid, ask, last, ins, venue, bq, aq, level] = r;
+        ts += 1000 + (ins & 7);
+        seq += 1 + (venue & 1);
+        bid += 1;
+        ask += 1;
+        last = (bid + ask) >> 1;
+        bq += 1;
+        aq -= 1;
+        level = (level + 1) & 15;
+    }
+}
+
+// ---- AoSoA: bloklar, blok içinde sabit uzunlukta düz döngü ----
+static int64_t scan_aosoa(const QuoteAoSoA& q) {
+    constexpr size_t B = QuoteAoSoA::block_size;
+    size_t full = q.size() / B;
+    int64_t s = 0;
+    for (size_t b = 0; b < full; b++) {
+        const int64_t* bid = q.lanes<BID_PX>(b);
+        const int64_t* ask = q.lanes<ASK_PX>(b);
+        for (size_t i = 0; i < B; i++) s += ask[i] - bid[i];
+    }
+    if (full < q.block_count()) {   // yarım son blok
+        const int64_t* bid = q.lanes<BID_PX>(full);
+        const int64_t* ask = q.lanes<ASK_PX>(full);
+        for (size_t i = 0; i < q.lanes_in(full); i++) s += ask[i] - bid[i];
+    }
+    return s;
+}
+
+static void update_aosoa(QuoteAoSoA& q) {
+    // Son bloğun geçersiz lane'leri de güncellenir; okunmadıkları için
+    // zararsızdır ve döngü sabit uzunlukta kalır.
+    for (size_t b = 0; b < q.block_count(); b++) {
+        update_columns(q.lanes<TS>(b), q.lanes<SEQ>(b), q.lanes<BID_PX>(b), q.lanes<ASK_PX>(b),
+                       q.lanes<LAST_PX>(b), q.lanes<INSTRUMENT>(b), q.lanes<VENUE>(b), q.lanes<BID_QTY>(b),
+                       q.lanes<ASK_QTY>(b), q.lanes<LEVEL>(b), QuoteAoSoA::block_size);
+    }
+}
+
+template <typename Layout>
+static int64_t checksum(const Layout& q) {
+    int64_t s = 0;
+    for (auto r : q) s += sum_fields(r);
+    return s;
+}
+
+static int64_t checksum(const vector<Quote>& q) {
+    int64_t s = 0;
+    for (const Quote& x : q) s += sum_fields(x);
+    return s;
+}
+
+struct Row {
+    string layout;
+    double ns[4];
+};
+
+static void run_size(size_t n) {
+    mt19937_64 rng(7);
+    vector<Quote> aos(n);
+    for (size_t i = 0; i < n; i++) {
+        int64_t mid = 100000 + rng() % 1000;
+        aos[i] = {int64_t(i) * 1000, int64_t(i), mid - 1, mid + 1 + int64_t(rng() % 3), mid,
+                  int32_t(rng() % 5000), int32_t(rng() % 8), int32_t(rng() % 100), int32_t(rng() % 100),
+                  int32_t(rng() % 16)};
+    }
+    QuoteSoA soa;
+    QuoteAoSoA aosoa;
+    soa.reserve(n);
+    aosoa.reserve(n);
+    for (const Quote& x : aos) {
+        soa.push_back(x.ts, x.seq, x.bid_px, x.ask_px, x.last_px, x.instrument, x.venue, x.bid_qty, x.ask_qty,
+                      x.level);
+        aosoa.push_back(x.ts, x.seq, x.bid_px, x.ask_px, x.last_px, x.instrument, x.venue, x.bid_qty,
+                        x.ask_qty, x.level);
+    }
+    vector<uint32_t> idx(RANDOM_LOOKUPS);
+    for (uint32_t& i : idx) i = rng() % n;
+
+    printf("\n=== %zu records (%zu KB as AoS) ===\n", n, n * sizeof(Quote) >> 10);
+
+    // Doğruluk: her iş bir kez, bütün yerleşimlerde aynı sonucu vermeli.
+    // update iki kez uygulanır (düz + proxy) ki SoA'nın iki yolu da sınansın.
+    bool ok = scan_aos(aos) == scan_soa(soa) && scan_aos(aos) == scan_soa_proxy(soa) &&
+              scan_aos(aos) == scan_aosoa(aosoa) && random_aos(aos, idx) == random_proxy(soa, idx) &&
+              random_aos(aos, idx) == random_proxy(aosoa, idx) && random2_aos(aos, idx) == random2_proxy(soa, idx) &&
+              random2_aos(aos, idx) == random2_proxy(aosoa, idx);
+    update_aos(aos), update_aos(aos);
+    update_soa(soa), update_soa_proxy(soa);
+    update_aosoa(aosoa), update_aosoa(aosoa);
+    ok = ok && checksum(aos) == checksum(soa) && checksum(aos) == checksum(aosoa);
+    printf("results %s across layouts\n\n", ok ? "match" : "DO NOT MATCH");
+
+    BenchOptions scan_opt, random_opt;
+    scan_opt.items = n;
+    scan_opt.max_ms = 500;
+    random_opt.items = RANDOM_LOOKUPS;
+    random_opt.max_ms = 500;
+
+    vector<Row> rows;
+    auto bench = [&](const string& layout, auto scan, auto update, auto random, auto random2) {
+        Row row{layout, {}};
+        const char* what[4] = {"scan 2/10", "update 10/10", "random 10/10", "random 2/10"};
+        BenchResult r[4] = {
+            run_benchmark(what[0] + string("  ") + layout, [&] { do_not_optimize(scan()); }, scan_opt),
+            run_benchmark(what[1] + string("  ") + layout, [&] { update(); clobber_memory(); }, scan_opt),
+            run_benchmark(what[2] + string("  ") + layout, [&] { do_not_optimize(random()); }, random_opt),
+            run_benchmark(what[3] + string("  ") + layout, [&] { do_not_optimize(random2()); }, random_opt)};
+        for (int k = 0; k < 4; k++) {
+            print_bench(r[k]);
+            row.ns[k] = r[k].ns_per_item();
+        }
+        rows.push_back(row);
+    };
+
+    print_bench_header();
+    bench("AoS", [&] { return scan_aos(aos); }, [&] { update_aos(aos); },
+          [&] { return random_aos(aos, idx); }, [&] { return random2_aos(aos, idx); });
+    bench("SoA", [&] { return scan_soa(soa); }, [&] { update_soa(soa); },
+          [&] { return random_proxy(soa, idx); }, [&] { return random2_proxy(soa, idx); });
+    bench("SoA proxy", [&] { return scan_soa_proxy(soa); }, [&] { update_soa_proxy(soa); },
+          [&] { return random_proxy(soa, idx); }, [&] { return random2_proxy(soa, idx); });
+    bench("AoSoA<16>", [&] { return scan_aosoa(aosoa); }, [&] { update_aosoa(aosoa); },
+          [&] { return random_proxy(aosoa, idx); }, [&] { return random2_proxy(aosoa, idx); });
+
+    printf("\n%-12s %12s %14s %14s %13s   (ns per record)\n", "", "scan 2/10", "update 10/10", "random 10/10",
+           "random 2/10");
+    for (const Row& r : rows) {
+        printf("%-12s %12.3f %14.3f %14.3f %13.3f\n", r.layout.c_str(), r.ns[0], r.ns[1], r.ns[2], r.ns[3]);
+    }
+}
+
+int main(int argc, char** argv) {
+    long records = argc > 1 ? atol(argv[1]) : 1 << 20;
+    if (records < 1) {
+        fprintf(stderr, "usage: %s [records >= 1]\n", argv[0]);
+        return 1;
+    }
+
+    print_bench_environment();
+    // Biri L2'ye sığan, biri sığmayan iki boyut.
+    run_size(16 << 10);
+    run_size(records);
+}
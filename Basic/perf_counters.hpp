@@ -0,0 +1,192 @@
+#pragma once
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/*
+ * PerfCounters
+ * Süre bir kernel'in ne kadar yavaş olduğunu söyler, neden yavaş olduğunu
+ * söylemez. Linux perf_event_open ile donanım sayaçları okunur:
+ *
+ *   cycles, instructions → IPC (cycle başına komut). Düşük IPC genelde
+ *                          bellek beklemesi demektir.
+ *   branch-misses        → yanlış tahmin edilen dallanmalar
+ *   L1D / LLC misses     → hangi cache seviyesinden kaçıyor
+ *   dTLB misses          → sayfa tablosu yürüyüşü (büyük/dağınık veri)
+ *
+ * Olaylar iki grupta açılır: {cycles, instructions, branch-misses} ve
+ * {L1D, LLC, dTLB}. Bir gruptaki sayaçlar hep birlikte çalışır, yani oranlar
+ * (IPC gibi) aynı zaman dilimine aittir. PMU'da yeterli sayaç yoksa çekirdek
+ * grupları sırayla çalıştırır (multiplexing); bu durumda değerler
+ * time_enabled / time_running ile ölçeklenir ve sonuç "multiplexed" olarak
+ * işaretlenir.
+ *
+ * Sadece kullanıcı alanı sayılır (exclude_kernel), böylece
+ * perf_event_paranoid = 2 ile de çalışır.
+ *
+ * Container'da (seccomp, paranoid = 3) ya da PMU'yu dışarı vermeyen bir
+ * sanal makinede sayaçlar açılamaz. Bu durumda available() false döner,
+ * notice() nedenini anlatır; ölçüm sadece TSC ile devam eder.
+ */
+class PerfCounters {
+public:
+    enum Event { Cycles, Instructions, BranchMisses, L1dMisses, LlcMisses, DtlbMisses, EVENT_COUNT };
+
+    struct Sample {
+        double value[EVENT_COUNT] = {};
+        bool valid[EVENT_COUNT] = {};
+        bool multiplexed = false;
+    };
+
+    PerfCounters() {
+        open_group({Cycles, Instructions, BranchMisses});
+        open_group({L1dMisses, LlcMisses, DtlbMisses});
+
+        std::string missing;
+        for (int e = 0; e < EVENT_COUNT; e++) {
+            if (!opened_[e]) {
+                missing += missing.empty() ? "" : ", ";
+                missing += name(e);
+            }
+        }
+        if (groups_.empty()) {
+            notice_ = "hardware counters unavailable (perf_event_open: " + std::string(std::strerror(first_errno_)) +
+                      ", " + explain(first_errno_) + "); timing only";
+        } else if (!missing.empty()) {
+            notice_ = "some counters unavailable: " + missing;
+        }
+    }
+
+    ~PerfCounters() {
+        for (Group& g : groups_) {
+            for (int fd : g.fds) {
+                close(fd);
+            }
+        }
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool available() const { return !groups_.empty(); }
+    const std::string& notice() const { return notice_; }
+
+    void start() {
+        for (Group& g : groups_) {
+            ioctl(g.fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(g.fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+    }
+
+    Sample stop() {
+        for (Group& g : groups_) {
+            ioctl(g.fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        }
+        Sample s;
+        for (Group& g : groups_) {
+            // PERF_FORMAT_GROUP düzeni: nr, time_enabled, time_running, values[nr]
+            std::uint64_t buf[3 + EVENT_COUNT];
+            ssize_t n = read(g.fds[0], buf, sizeof(buf));
+            if (n < static_cast<ssize_t>(3 * sizeof(std::uint64_t)) || buf[2] == 0) {
+                continue;   // grup hiç çalışmadı
+            }
+            double scale = 1.0;
+            if (buf[2] < buf[1]) {
+                scale = double(buf[1]) / buf[2];
+                s.multiplexed = true;
+            }
+            for (std::uint64_t i = 0; i < buf[0] && i < g.events.size(); i++) {
+                s.value[g.events[i]] = buf[3 + i] * scale;
+                s.valid[g.events[i]] = true;
+            }
+        }
+        return s;
+    }
+
+    static const char* name(int e) {
+        static const char* names[EVENT_COUNT] = {"cycles", "instructions", "branch-misses",
+                                                 "L1D-misses", "LLC-misses", "dTLB-misses"};
+        return names[e];
+    }
+
+private:
+    struct Group {
+        std::vector<int> fds;      // fds[0] lider
+        std::vector<int> events;   // okuma sırasıyla aynı
+    };
+
+    static perf_event_attr attr_for(int e) {
+        perf_event_attr a;
+        std::memset(&a, 0, sizeof(a));
+        a.size = sizeof(a);
+        auto cache = [](std::uint64_t id) {
+            return id | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        };
+        switch (e) {
+            case Cycles:       a.type = PERF_TYPE_HARDWARE; a.config = PERF_COUNT_HW_CPU_CYCLES; break;
+            case Instructions: a.type = PERF_TYPE_HARDWARE; a.config = PERF_COUNT_HW_INSTRUCTIONS; break;
+            case BranchMisses: a.type = PERF_TYPE_HARDWARE; a.config = PERF_COUNT_HW_BRANCH_MISSES; break;
+            case L1dMisses:    a.type = PERF_TYPE_HW_CACHE; a.config = cache(PERF_COUNT_HW_CACHE_L1D); break;
+            case LlcMisses:    a.type = PERF_TYPE_HW_CACHE; a.config = cache(PERF_COUNT_HW_CACHE_LL); break;
+            case DtlbMisses:   a.type = PERF_TYPE_HW_CACHE; a.config = cache(PERF_COUNT_HW_CACHE_DTLB); break;
+        }
+        a.exclude_kernel = 1;
+        a.exclude_hv = 1;
+        a.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return a;
+    }
+
+    // Açılamayan olay atlanır; lider açılamazsa sıradaki olay lider olur.
+    void open_group(std::initializer_list<int> events) {
+        Group g;
+        for (int e : events) {
+            perf_event_attr a = attr_for(e);
+            a.disabled = g.fds.empty() ? 1 : 0;   // grup lider üzerinden açılıp kapanır
+            int leader = g.fds.empty() ? -1 : g.fds[0];
+            int fd = static_cast<int>(syscall(SYS_perf_event_open, &a, 0, -1, leader, 0));
+            if (fd < 0) {
+                if (!first_errno_) first_errno_ = errno;
+                continue;
+            }
+            g.fds.push_back(fd);
+            g.events.push_back(e);
+            opened_[e] = true;
+        }
+        if (!g.fds.empty()) {
+            groups_.push_back(std::move(g));
+        }
+    }
+
+    static std::string explain(int err) {
+        std::string paranoid;
+        std::ifstream("/proc/sys/kernel/perf_event_paranoid") >> paranoid;
+        switch (err) {
+            case EACCES:
+            case EPERM:
+                return "not permitted; perf_event_paranoid = " + (paranoid.empty() ? "?" : paranoid) +
+                       ", containers may also block the syscall via seccomp";
+            case ENOENT:
+            case EOPNOTSUPP:
+                return "the CPU/hypervisor does not expose these events (virtual machine without vPMU?)";
+            case ENOSYS:
+                return "kernel built without perf events";
+            default:
+                return "perf_event_paranoid = " + (paranoid.empty() ? "?" : paranoid);
+        }
+    }
+
+    std::vector<Group> groups_;
+    bool opened_[EVENT_COUNT] = {};
+    int first_errno_ = 0;
+    std::string notice_;
+};
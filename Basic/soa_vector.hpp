@@ -0,0 +1,236 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+ * soa_vector<Fields...> ve aosoa_vector<B, Fields...>
+ *
+ * vector<Quote> (AoS, array of structs) bir kaydın bütün alanlarını yan
+ * yana tutar. On alandan sadece ikisini tarayan bir döngü her kayıt için
+ * yine koca bir cache line getirir; getirilen byte'ların çoğu kullanılmaz
+ * ve alanlar arası atlama (stride) yüzünden döngü vektörleşmez.
+ *
+ *   AoS    : [ts seq bid ask ...][ts seq bid ask ...] ...
+ *   SoA    : [ts ts ts ...] [seq seq seq ...] [bid bid bid ...] ...
+ *   AoSoA  : [ts×B seq×B bid×B ...][ts×B seq×B bid×B ...] ...
+ *
+ * soa_vector her alanı kendi std::vector'ünde tutar (SoA): alt küme
+ * taramaları sadece gereken sütunları okur ve düz dizi döngüsü olarak
+ * vektörleşir. Bedeli: tek bir kaydın tamamına erişmek her alan için ayrı
+ * bir cache line (ve rastgele erişimde ayrı bir TLB girişi) demektir.
+ *
+ * aosoa_vector kayıtları B'li bloklara böler, blok içinde her alan B
+ * elemanlık bir dizidir. Taramalar blok içinde SoA gibi vektörleşir; bir
+ * kaydın alanları ise aynı blokta, birbirine yakın durur. B 2'nin kuvveti
+ * olmalıdır (i / B kaydırmaya dönüşür); bloklar 64 byte hizalıdır.
+ *
+ * İkisi de operator[] ile soa_ref döndürür: kaydın alanlarını gösteren
+ * pointer'lardan oluşan bir proxy. Alanlara indeksle erişilir ve yazılır:
+ *
+ *   enum { TS, BID, ASK };
+ *   soa_vector<int64_t, int64_t, int64_t> v;
+ *   v.push_back(1, 100, 101);
+ *   v[0].get<BID>() += 1;
+ *   auto [ts, bid, ask] = v[0];        // referanslar, kopya değil
+ *   std::tuple<...> copy = v[0];       // değer olarak kopya
+ *   v[1] = v[0];                       // alan alan atama
+ *
+ * Sıcak döngülerde proxy yerine data<I>() ile sütun pointer'ı
+ * (aosoa_vector'de lanes<I>(block)) alınıp düz döngü yazılması önerilir;
+ * proxy inline edilir ama derleyicinin sütunlar arasında aliasing
+ * olmadığını görmesi düz pointer'larla daha kolaydır.
+ */
+
+template <typename... Fields>
+class soa_ref {
+public:
+    using value_type = std::tuple<std::remove_const_t<Fields>...>;
+
+    explicit soa_ref(Fields*... fields) : ptrs_(fields...) {}
+    soa_ref(const soa_ref&) = default;
+
+    template <std::size_t I>
+    auto& get() const { return *std::get<I>(ptrs_); }
+
+    operator value_type() const {
+        return std::apply([](Fields*... p) { return value_type(*p...); }, ptrs_);
+    }
+
+    // Atama pointer'ları değil, gösterilen alanları değiştirir.
+    soa_ref& operator=(const value_type& v) {
+        assign(v, std::index_sequence_for<Fields...>{});
+        return *this;
+    }
+    soa_ref& operator=(const soa_ref& other) { return *this = value_type(other); }
+
+private:
+    template <std::size_t... I>
+    void assign(const value_type& v, std::index_sequence<I...>) {
+        ((*std::get<I>(ptrs_) = std::get<I>(v)), ...);
+    }
+
+    std::tuple<Fields*...> ptrs_;
+};
+
+template <std::size_t I, typename... Fields>
+auto& get(const soa_ref<Fields...>& r) { return r.template get<I>(); }
+
+// Structured binding desteği: auto [a, b] = v[i];
+template <typename... Fields>
+struct std::tuple_size<soa_ref<Fields...>> : std::integral_constant<std::size_t, sizeof...(Fields)> {};
+
+template <std::size_t I, typename... Fields>
+struct std::tuple_element<I, soa_ref<Fields...>> {
+    using type = std::tuple_element_t<I, std::tuple<Fields...>>;
+};
+
+// İndeks tutan iterator; *it → container[i] (soa_ref).
+template <typename Container, typename Ref>
+class soa_iterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename Ref::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = Ref;
+
+    soa_iterator(Container* c, std::size_t i) : c_(c), i_(i) {}
+    Ref operator*() const { return (*c_)[i_]; }
+    soa_iterator& operator++() { i_++; return *this; }
+    soa_iterator operator++(int) { soa_iterator t = *this; i_++; return t; }
+    bool operator==(const soa_iterator& o) const { return i_ == o.i_; }
+
+private:
+    Container* c_;
+    std::size_t i_;
+};
+
+template <typename... Fields>
+class soa_vector {
+public:
+    using value_type = std::tuple<Fields...>;
+    using reference = soa_ref<Fields...>;
+    using const_reference = soa_ref<const Fields...>;
+    using iterator = soa_iterator<soa_vector, reference>;
+    using const_iterator = soa_iterator<const soa_vector, const_reference>;
+    template <std::size_t I>
+    using field_type = std::tuple_element_t<I, value_type>;
+
+    soa_vector() = default;
+    explicit soa_vector(std::size_t n) { resize(n); }
+
+    std::size_t size() const { return std::get<0>(columns_).size(); }
+    bool empty() const { return size() == 0; }
+    void reserve(std::size_t n) { each([n](auto& c) { c.reserve(n); }); }
+    void resize(std::size_t n) { each([n](auto& c) { c.resize(n); }); }
+    void clear() { each([](auto& c) { c.clear(); }); }
+
+    void push_back(const Fields&... fields) {
+        std::apply([&](auto&... c) { (c.push_back(fields), ...); }, columns_);
+    }
+    void push_back(const value_type& v) {
+        std::apply([this](const Fields&... f) { push_back(f...); }, v);
+    }
+
+    reference operator[](std::size_t i) {
+        return std::apply([i](auto&... c) { return reference(&c[i]...); }, columns_);
+    }
+    const_reference operator[](std::size_t i) const {
+        return std::apply([i](const auto&... c) { return const_reference(&c[i]...); }, columns_);
+    }
+
+    // I. alanın sütunu: size() elemanlık düz dizi.
+    template <std::size_t I>
+    field_type<I>* data() { return std::get<I>(columns_).data(); }
+    template <std::size_t I>
+    const field_type<I>* data() const { return std::get<I>(columns_).data(); }
+
+    iterator begin() { return {this, 0}; }
+    iterator end() { return {this, size()}; }
+    const_iterator begin() const { return {this, 0}; }
+    const_iterator end() const { return {this, size()}; }
+
+private:
+    template <typename F>
+    void each(F f) {
+        std::apply([&](auto&... c) { (f(c), ...); }, columns_);
+    }
+
+    std::tuple<std::vector<Fields>...> columns_;
+};
+
+template <std::size_t B, typename... Fields>
+class aosoa_vector {
+    static_assert(B > 0 && (B & (B - 1)) == 0, "block size must be a power of two");
+
+    struct alignas(64) Block {
+        std::tuple<std::array<Fields, B>...> lanes;
+    };
+
+public:
+    static constexpr std::size_t block_size = B;
+    using value_type = std::tuple<Fields...>;
+    using reference = soa_ref<Fields...>;
+    using const_reference = soa_ref<const Fields...>;
+    using iterator = soa_iterator<aosoa_vector, reference>;
+    using const_iterator = soa_iterator<const aosoa_vector, const_reference>;
+    template <std::size_t I>
+    using field_type = std::tuple_element_t<I, value_type>;
+
+    aosoa_vector() = default;
+    explicit aosoa_vector(std::size_t n) { resize(n); }
+
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    void reserve(std::size_t n) { blocks_.reserve((n + B - 1) / B); }
+    void resize(std::size_t n) {
+        blocks_.resize((n + B - 1) / B);
+        size_ = n;
+    }
+    void clear() {
+        blocks_.clear();
+        size_ = 0;
+    }
+
+    void push_back(const Fields&... fields) {
+        if (size_ % B == 0) blocks_.emplace_back();
+        (*this)[size_++] = value_type(fields...);
+    }
+    void push_back(const value_type& v) {
+        std::apply([this](const Fields&... f) { push_back(f...); }, v);
+    }
+
+    reference operator[](std::size_t i) {
+        Block& b = blocks_[i / B];
+        std::size_t lane = i % B;
+        return std::apply([lane](auto&... a) { return reference(&a[lane]...); }, b.lanes);
+    }
+    const_reference operator[](std::size_t i) const {
+        const Block& b = blocks_[i / B];
+        std::size_t lane = i % B;
+        return std::apply([lane](const auto&... a) { return const_reference(&a[lane]...); }, b.lanes);
+    }
+
+    // Blok bazında erişim: lanes<I>(b) b. bloktaki I. alanın B elemanlık
+    // dizisidir; son blokta sadece lanes_in(b) tanesi geçerlidir.
+    std::size_t block_count() const { return blocks_.size(); }
+    std::size_t lanes_in(std::size_t b) const { return b + 1 < blocks_.size() ? B : size_ - b * B; }
+
+    template <std::size_t I>
+    field_type<I>* lanes(std::size_t b) { return std::get<I>(blocks_[b].lanes).data(); }
+    template <std::size_t I>
+    const field_type<I>* lanes(std::size_t b) const { return std::get<I>(blocks_[b].lanes).data(); }
+
+    iterator begin() { return {this, 0}; }
+    iterator end() { return {this, size_}; }
+    const_iterator begin() const { return {this, 0}; }
+    const_iterator end() const { return {this, size_}; }
+
+private:
+    std::vector<Block> blocks_;
+    std::size_t size_ = 0;
+};
@@ -0,0 +1,287 @@
+#include <bits/stdc++.h>
+#include <omp.h>
+#include <immintrin.h>
+#include "bench.hpp"
+#include "../First/first_touch.hpp"
+using namespace std;
+
+// STREAM benzeri bellek bant genişliği ölçümü.
+// array_benchmark.cpp 40 MB'ı tek thread ile bir kez toplar; bu, kodun
+// hesaplama mı yoksa bellek mi ile sınırlandığını göstermez. Burada her
+// makine için bant genişliği tavanı ölçülür.
+//
+// Kernel'ler (a, b, c double dizileri, s sabit):
+//   copy    c = a            16 byte/eleman
+//   scale   b = s*c          16
+//   add     c = a + b        24
+//   triad   a = b + s*c      24
+//   read    sum += a          8   (sadece okuma)
+//   write   a = s             8   (sadece yazma)
+//   *_nt    aynı kernel, non-temporal (streaming) store ile
+//
+// Byte sayıları STREAM kuralıyla hesaplanır: okunan + yazılan diziler.
+// Normal bir store'da CPU önce hedef line'ı okur (read-for-ownership), yani
+// copy gerçekte 24 byte/eleman trafik üretir. NT store cache'i atlar ve bu
+// okumayı yapmaz; DRAM boyutlarında *_nt sürümlerinin hızlı çıkması bundandır.
+// Cache'e sığan boyutlarda ise NT store veriyi cache'den attığı için yavaştır.
+//
+// Her boyut ve thread sayısı için GB/s tablosu, sonda da en büyük boyutta
+// (DRAM) her kernel'in en iyi değeri ve hangi thread sayısında ulaşıldığı
+// yazdırılır. Küçük boyutlarda omp parallel'in fork/join maliyeti de ölçüme
+// girer.
+//
+// Thread'ler bağlanmalı: OMP_PROC_BIND=spread OMP_PLACES=cores ./stream_benchmark
+//
+// g++ -std=c++20 -O3 -march=native -fopenmp stream_benchmark.cpp -o stream_benchmark
+// ./stream_benchmark [max_threads] [max_MB per array]
+
+const double SCALAR = 3.0;
+const double A0 = 1.0, B0 = 2.0, C0 = 0.5;   // başlangıç değerleri
+
+// Thread t'nin bloğu: sınırlar 8 double'a (64 byte) yuvarlanır, böylece her
+// blok cache line başında başlar ve NT store'lar hizalı olur.
+static void block_of(size_t n, int t, int nt, size_t& begin, size_t& end) {
+    size_t lines = (n + 7) / 8;
+    begin = min(n, lines * t / nt * 8);
+    end = min(n, lines * (t + 1) / nt * 8);
+}
+
+// body(begin, end) her thread için kendi bloğunda çağrılır.
+template <typename Body>
+static void stream_for(size_t n, Body body) {
+    #pragma omp parallel
+    {
+        size_t b, e;
+        block_of(n, omp_get_thread_num(), omp_get_num_threads(), b, e);
+        body(b, e);
+    }
+}
+
+// Non-temporal store yardımcıları. dst 64 byte hizalı başlar (block_of),
+// 4/2'nin katı olmayan kuyruk normal store ile yazılır.
+#if defined(__AVX__)
+constexpr size_t NT_WIDTH = 4;
+static inline void nt_store(double* p, __m256d v) { _mm256_stream_pd(p, v); }
+static inline __m256d nt_load(const double* p) { return _mm256_load_pd(p); }
+static inline __m256d nt_set1(double x) { return _mm256_set1_pd(x); }
+static inline __m256d nt_add(__m256d a, __m256d b) { return _mm256_add_pd(a, b); }
+static inline __m256d nt_mul(__m256d a, __m256d b) { return _mm256_mul_pd(a, b); }
+#else
+constexpr size_t NT_WIDTH = 2;
+static inline void nt_store(double* p, __m128d v) { _mm_stream_pd(p, v); }
+static inline __m128d nt_load(const double* p) { return _mm_load_pd(p); }
+static inline __m128d nt_set1(double x) { return _mm_set1_pd(x); }
+static inline __m128d nt_add(__m128d a, __m128d b) { return _mm_add_pd(a, b); }
+static inline __m128d nt_mul(__m128d a, __m128d b) { return _mm_mul_pd(a, b); }
+#endif
+
+struct Arrays {
+    first_touch_vector<double> a, b, c;
+    size_t n;
+
+    // İlk reset() sayfaları kernel'lerle aynı bloklarda, aynı thread'lerde dokunur.
+    explicit Arrays(size_t n) : a(n), b(n), c(n), n(n) { reset(); }
+
+    // Her kernel'in çıktısı kendi girdilerinden biri değildir; reset()'ten sonra
+    // kernel kaç kez çalışırsa çalışsın sonuç aynıdır ve kontrol edilebilir.
+    void reset() {
+        stream_for(n, [&](size_t lo, size_t hi) {
+            for (size_t i = lo; i < hi; i++) {
+                a[i] = A0;
+                b[i] = B0;
+                c[i] = C0;
+            }
+        });
+    }
+};
+
+struct Kernel {
+    const char* name;
+    int arrays;                      // okunan + yazılan dizi sayısı (STREAM kuralı)
+    function<void(Arrays&)> run;
+    function<bool(const Arrays&)> check;
+};
+
+static bool all_equal(const first_touch_vector<double>& v, double x) {
+    size_t n = v.size();
+    return v[0] == x && v[n / 2] == x && v[n - 1] == x;
+}
+
+static vector<Kernel> make_kernels() {
+    vector<Kernel> k;
+    k.push_back({"copy", 2, [](Arrays& d) {
+        double* __restrict c = d.c.data();
+        const double* __restrict a = d.a.data();
+        stream_for(d.n, [&](size_t lo, size_t hi) {
+            for (size_t i = lo; i < hi; i++) c[i] = a[i];
+        });
+    }, [](const Arrays& d) { return all_equal(d.c, A0); }});
+
+    k.push_back({"scale", 2, [](Arrays& d) {
+        double* __restrict b = d.b.data();
+        const double* __restrict c = d.c.data();
+        stream_for(d.n, [&](size_t lo, size_t hi) {
+            for (size_t i = lo; i < hi; i++) b[i] = SCALAR * c[i];
+        });
+    }, [](const Arrays& d) { return all_equal(d.b, SCALAR * C0); }});
+
+    k.push_back({"add", 3, [](Arrays& d) {
+        double* __restrict c = d.c.data();
+        const double* __restrict a = d.a.data();
+        const double* __restrict b = d.b.data();
+        stream_for(d.n, [&](size_t lo, size_t hi) {
+            for (size_t i = lo; i < hi; i++) c[i] = a[i] + b[i];
+        });
+    }, [](const Arrays& d) { return all_equal(d.c, A0 + B0); }});
+
+    k.push_back({"triad", 3, [](Arrays& d) {
+        double* __restrict a = d.a.data();
+        const double* __restrict b = d.b.data();
+        const double* __restrict c = d.c.data();
+        stream_for(d.n, [&](size_t lo, size_t hi) {
+            for (size_t i = lo; i < hi; i++) a[i] = b[i] + SCALAR * c[i];
+        });
+    }, [](const Arrays& d) { return all_equal(d.a, B0 + SCALAR * C0); }});
+
+    // read: sonuç kullanılmazsa derleyici döngüyü siler.
+    k.push_back({"read", 1, [](Arrays& d) {
+        const double* a = d.a.data();
+        double total = 0;
+        #pragma omp parallel reduction(+:total)
+        {
+            size_t lo, hi;
+            block_of(d.n, omp_get_thread_num(), omp_get_num_threads(), lo, hi);
+            double s = 0;
+            #pragma omp simd reduction(+:s)
+            for (size_t i = lo; i < hi; i++) s += a[i];
+            total += s;
+        }
+        do_not_optimize(total);
+    }, [](const Arrays&) { return true; }});
+
+    k.push_back({"write", 1, [](Arrays& d) {
+        double* c = d.c.data();
+        stream_for(d.n, [&](size_t lo, size_t hi) {
+            for (size_t i = lo; i < hi; i++) c[i] = SCALAR;
+        });
+    }, [](const Arrays& d) { return all_equal(d.c, SCALAR); }});
+
+    // ---- non-temporal store sürümleri ----
+    auto nt = [](size_t lo, size_t hi, auto vec, auto scalar) {
+        size_t i = lo;
+        for (; i + NT_WIDTH <= hi; i += NT_WIDTH) vec(i);
+        for (; i < hi; i++) scalar(i);
+        _mm_sfence();   // NT store'lar sıralı değildir, thread bitmeden görünür olsun
+    };
+
+    k.push_back({"copy_nt", 2, [nt](Arrays& d) {
+        double* c = d.c.data();
+        const double* a = d.a.data();
+        stream_for(d.n, [&](size_t lo, size_t hi) {
+            nt(lo, hi, [&](size_t i) { nt_store(c + i, nt_load(a + i)); }, [&](size_t i) { c[i] = a[i]; });
+        });
+    }, [](const Arrays& d) { return all_equal(d.c, A0); }});
+
+    k.push_back({"scale_nt", 2, [nt](Arrays& d) {
+        double* b = d.b.data();
+        const double* c = d.c.data();
+        auto s = nt_set1(SCALAR);
+        stream_for(d.n, [&](size_t lo, size_t hi) {
+            nt(lo, hi, [&](size_t i) { nt_store(b + i, nt_mul(s, nt_load(c + i))); },
+               [&](size_t i) { b[i] = SCALAR * c[i]; });
+        });
+    }, [](const Arrays& d) { return all_equal(d.b, SCALAR * C0); }});
+
+    k.push_back({"add_nt", 3, [nt](Arrays& d) {
+        double* c = d.c.data();
+        const double* a = d.a.data();
+        const double* b = d.b.data();
+        stream_for(d.n, [&](size_t lo, size_t hi) {
+            nt(lo, hi, [&](size_t i) { nt_store(c + i, nt_add(nt_load(a + i), nt_load(b + i))); },
+               [&](size_t i) { c[i] = a[i] + b[i]; });
+        });
+    }, [](const Arrays& d) { return all_equal(d.c, A0 + B0); }});
+
+    k.push_back({"triad_nt", 3, [nt](Arrays& d) {
+        double* a = d.a.data();
+        const double* b = d.b.data();
+        const double* c = d.c.data();
+        auto s = nt_set1(SCALAR);
+        stream_for(d.n, [&](size_t lo, size_t hi) {
+            nt(lo, hi, [&](size_t i) { nt_store(a + i, nt_add(nt_load(b + i), nt_mul(s, nt_load(c + i)))); },
+               [&](size_t i) { a[i] = b[i] + SCALAR * c[i]; });
+        });
+    }, [](const Arrays& d) { return all_equal(d.a, B0 + SCALAR * C0); }});
+
+    k.push_back({"write_nt", 1, [nt](Arrays& d) {
+        double* c = d.c.data();
+        auto s = nt_set1(SCALAR);
+        stream_for(d.n, [&](size_t lo, size_t hi) {
+            nt(lo, hi, [&](size_t i) { nt_store(c + i, s); }, [&](size_t i) { c[i] = SCALAR; });
+        });
+    }, [](const Arrays& d) { return all_equal(d.c, SCALAR); }});
+
+    return k;
+}
+
+int main(int argc, char** argv) {
+    int max_threads = argc > 1 ? atoi(argv[1]) : omp_get_num_procs();
+    long max_mb_arg = argc > 2 ? atol(argv[2]) : 128;
+    if (max_threads < 1 || max_mb_arg < 1) {
+        fprintf(stderr, "usage: %s [max_threads >= 1] [max_MB per array >= 1]\n", argv[0]);
+        return 1;
+    }
+    size_t max_mb = max_mb_arg;
+
+    print_bench_environment();
+    printf("%d max threads, arrays up to %zu MB each (3 arrays)\n", max_threads, max_mb);
+
+    vector<int> thread_counts;
+    for (int t = 1; t <= max_threads; t *= 2) thread_counts.push_back(t);
+    if (thread_counts.back() != max_threads) thread_counts.push_back(max_threads);
+
+    // 32 KB (L1), 256 KB (L2), 2 MB, 16 MB (L3), max_mb (DRAM)
+    vector<size_t> sizes_kb = {32, 256, 2048, 16384};
+    sizes_kb.erase(remove_if(sizes_kb.begin(), sizes_kb.end(), [&](size_t kb) { return kb >= max_mb * 1024; }),
+                   sizes_kb.end());
+    sizes_kb.push_back(max_mb * 1024);
+
+    vector<Kernel> kernels = make_kernels();
+    BenchOptions opt;
+    opt.warmup_ms = 20;
+    opt.min_samples = 16;
+    opt.max_ms = 300;
+
+    // En büyük boyut için her kernel'in en iyi GB/s değeri ve thread sayısı.
+    vector<pair<double, int>> ceiling(kernels.size(), {0.0, 0});
+
+    for (size_t kb : sizes_kb) {
+        size_t n = kb * 1024 / sizeof(double);
+        Arrays data(n);
+        printf("\n=== %zu KB per array ===\n%8s", kb, "threads");
+        for (const Kernel& k : kernels) printf(" %9s", k.name);
+        printf("   (GB/s)\n");
+
+        for (int t : thread_counts) {
+            omp_set_num_threads(t);
+            printf("%8d", t);
+            for (size_t ki = 0; ki < kernels.size(); ki++) {
+                Kernel& k = kernels[ki];
+                double bytes = double(k.arrays) * n * sizeof(double);
+                data.reset();
+                BenchResult r = run_benchmark(k.name, [&] { k.run(data); }, opt);
+                double gbs = bytes / r.median_ns();
+                bool ok = k.check(data);
+                printf(" %8.1f%s", gbs, ok ? (r.stable ? " " : "~") : "!");
+                if (kb == sizes_kb.back() && gbs > ceiling[ki].first) ceiling[ki] = {gbs, t};
+            }
+            printf("\n");
+        }
+    }
+    printf("\n~ = not stable within the time limit, ! = wrong result\n");
+
+    printf("\n=== bandwidth ceiling (%zu MB arrays) ===\n", max_mb);
+    for (size_t ki = 0; ki < kernels.size(); ki++) {
+        printf("%-10s %8.1f GB/s at %d threads\n", kernels[ki].name, ceiling[ki].first, ceiling[ki].second);
+    }
+}
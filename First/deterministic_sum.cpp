@@ -0,0 +1,132 @@
+#include <omp.h>
+#include <iostream>
+#include <vector>
+#include <random>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#include <cstdio>
+#include "deterministic_sum.hpp"
+using namespace std;
+
+// deterministic_sum'ın farklı thread sayılarında bit-bit aynı sonuç
+// verdiğini ve naif reduction'a göre ne kadar yavaş olduğunu ölçüyoruz.
+//
+// İki veri seti var:
+//   pi terms   → pi_comparison.c'deki 4/(1+x^2) terimleri
+//   ill-cond.  → çok farklı büyüklükte, karışık işaretli sayılar; burada
+//                toplama sırası sonucu ciddi şekilde değiştirir
+//
+// g++ -std=c++20 -O2 -march=native -fopenmp deterministic_sum.cpp -o deterministic_sum
+// (-ffast-math KULLANMAYIN, compensation terimlerini siler)
+
+static uint64_t bits(double d) {
+    uint64_t u;
+    memcpy(&u, &d, sizeof(u));
+    return u;
+}
+
+// Referans: long double ile seri Neumaier toplamı.
+static long double reference_sum(const vector<double>& v) {
+    long double s = 0, c = 0;
+    for (double x : v) {
+        long double t = s + x;
+        c += fabsl(s) >= fabsl(x) ? (s - t) + x : (x - t) + s;
+        s = t;
+    }
+    return s + c;
+}
+
+static double naive_reduction(const vector<double>& v) {
+    double sum = 0.0;
+    long n = v.size();
+    #pragma omp parallel for reduction(+:sum)
+    for (long i = 0; i < n; i++) {
+        sum += v[i];
+    }
+    return sum;
+}
+
+// Derleyicinin vektörleştirmesine izin verilen naif toplam (asıl hız rakibi).
+static double naive_simd_reduction(const vector<double>& v) {
+    double sum = 0.0;
+    long n = v.size();
+    #pragma omp parallel for simd reduction(+:sum)
+    for (long i = 0; i < n; i++) {
+        sum += v[i];
+    }
+    return sum;
+}
+
+template <typename F>
+static double best_time(F f, double& result) {
+    double best = 1e30;
+    for (int r = 0; r < 5; r++) {
+        double t0 = omp_get_wtime();
+        result = f();
+        best = min(best, omp_get_wtime() - t0);
+    }
+    return best;
+}
+
+static void run(const char* name, const vector<double>& v, int max_threads) {
+    long double ref = reference_sum(v);
+    double gb = v.size() * sizeof(double) / 1e9;
+
+    printf("\n=== %s (%zu elements, reference %.17Lg) ===\n", name, v.size(), ref);
+    printf("%4s | %-26s %9s | %-26s %9s | %-26s %9s\n", "thr",
+           "naive reduction", "GB/s", "naive simd reduction", "GB/s", "deterministic_sum", "GB/s");
+
+    uint64_t first_det = 0;
+    bool det_identical = true;
+    double det_err = 0, naive_err = 0;
+
+    vector<int> thread_counts;
+    for (int t = 1; t <= max_threads; t *= 2) thread_counts.push_back(t);
+    if (thread_counts.back() != max_threads) thread_counts.push_back(max_threads);
+
+    for (int t : thread_counts) {
+        omp_set_num_threads(t);
+        double a, b, c;
+        double ta = best_time([&] { return naive_reduction(v); }, a);
+        double tb = best_time([&] { return naive_simd_reduction(v); }, b);
+        double tc = best_time([&] { return deterministic_sum(v); }, c);
+
+        if (t == 1) first_det = bits(c);
+        det_identical &= bits(c) == first_det;
+        naive_err = max(naive_err, (double)fabsl(a - ref));
+        det_err = max(det_err, (double)fabsl(c - ref));
+
+        printf("%4d | %-26.17g %9.2f | %-26.17g %9.2f | %-26.17g %9.2f   (det/simd speed %.0f%%)\n",
+               t, a, gb / ta, b, gb / tb, c, gb / tc, 100.0 * tb / tc);
+    }
+    printf("deterministic_sum bit-identical across thread counts: %s\n", det_identical ? "yes" : "NO");
+    printf("max |error|: naive %.3g, deterministic %.3g\n", naive_err, det_err);
+}
+
+int main(int argc, char** argv) {
+    int max_threads = argc > 1 ? atoi(argv[1]) : omp_get_num_procs();
+    if (max_threads < 1) {
+        fprintf(stderr, "usage: %s [max_threads >= 1]\n", argv[0]);
+        return 1;
+    }
+    const long N = 1L << 24;
+
+    vector<double> pi_terms(N);
+    double step = 1.0 / N;
+    for (long i = 0; i < N; i++) {
+        double x = (i + 0.5) * step;
+        pi_terms[i] = 4.0 / (1.0 + x * x) * step;
+    }
+
+    vector<double> ill(N);
+    mt19937_64 rng(42);
+    uniform_real_distribution<double> mant(-1.0, 1.0);
+    uniform_int_distribution<int> expo(-30, 30);
+    for (long i = 0; i < N; i++) {
+        ill[i] = ldexp(mant(rng), expo(rng));
+    }
+
+    run("pi terms", pi_terms, max_threads);
+    run("ill-conditioned", ill, max_threads);
+}
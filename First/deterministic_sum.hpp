@@ -0,0 +1,145 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+/*
+ * deterministic_sum
+ * pi_comparison.c'deki varyantlar aynı terimleri topladığı halde son
+ * hanelerde farklı sonuç verebiliyor: floating-point toplama birleşmeli
+ * (associative) değildir ve her varyant thread'lerin kısmi toplamlarını
+ * farklı sırada birleştirir. Thread sayısı değişince sonuç da değişir.
+ *
+ * Burada toplama sırası thread sayısından tamamen bağımsız hale getirilir:
+ *   1) Dizi sabit boyutlu bloklara (DSUM_BLOCK) bölünür. Blok sınırları
+ *      sadece n'e bağlıdır; hangi thread'in hangi bloğu aldığı önemsizdir.
+ *   2) Her blok DSUM_LANES şeritli (lane) compensated toplam ile hesaplanır.
+ *      Şeritler birbirinden bağımsız olduğu için SIMD register'larında
+ *      paralel ilerler ve her şeritteki kayıp (compensation) ayrıca tutulur.
+ *   3) Şeritler ve ardından bloklar double-double (hi + lo) olarak sabit bir
+ *      ikili ağaç (pairwise tree) sırasıyla birleştirilir.
+ * Sonuç: aynı binary ile 1, 2, 4 ... thread bit-bit aynı sonucu verir ve
+ * compensation sayesinde naif toplamdan çok daha doğrudur.
+ *
+ * Dikkat: -ffast-math ile derlenirse derleyici compensation terimlerini
+ * cebirsel olarak sıfır sayıp silebilir. Bu dosya -O2/-O3 ile kullanılmalı.
+ */
+
+constexpr std::size_t DSUM_BLOCK = 8192;
+constexpr std::size_t DSUM_LANES = 16;
+
+// hi + lo şeklinde, yaklaşık 106 bit hassasiyetli sayı.
+struct dsum_dd {
+    double hi;
+    double lo;
+};
+
+// Knuth TwoSum: a + b = s + err, tam olarak (hatasız dönüşüm).
+inline dsum_dd dsum_two_sum(double a, double b) {
+    double s = a + b;
+    double bb = s - a;
+    double err = (a - (s - bb)) + (b - bb);
+    return {s, err};
+}
+
+inline dsum_dd dsum_add(dsum_dd a, dsum_dd b) {
+    dsum_dd s = dsum_two_sum(a.hi, b.hi);
+    double lo = s.lo + (a.lo + b.lo);
+    // Fast TwoSum ile normalize et (|s.hi| >= |lo|).
+    double hi = s.hi + lo;
+    return {hi, lo - (hi - s.hi)};
+}
+
+// Diziyi yerinde, sabit ikili ağaç sırasıyla birleştirir: (0+1), (2+3), ...
+inline dsum_dd dsum_tree(dsum_dd* v, std::size_t n) {
+    if (n == 0) {
+        return {0.0, 0.0};
+    }
+    for (std::size_t width = 1; width < n; width *= 2) {
+        for (std::size_t i = 0; i + width < n; i += 2 * width) {
+            v[i] = dsum_add(v[i], v[i + width]);
+        }
+    }
+    return v[0];
+}
+
+// Hedef ISA'nın doğal vektör genişliği (GCC/Clang vector extension).
+// Daha geniş bir tip de yazılabilirdi ama GCC register'dan geniş vektörleri
+// stack üzerinden parçalayarak derliyor; bu yüzden genişlik ISA'ya göre
+// seçilir ve 16 şerit DSUM_ACC tane accumulator'a bölünür.
+#if defined(__AVX512F__)
+constexpr std::size_t DSUM_WIDTH = 8;
+#elif defined(__AVX__)
+constexpr std::size_t DSUM_WIDTH = 4;
+#else
+constexpr std::size_t DSUM_WIDTH = 2;
+#endif
+constexpr std::size_t DSUM_ACC = DSUM_LANES / DSUM_WIDTH;
+// Şerit l her zaman i % DSUM_LANES indisli elemanları toplar; genişlik
+// değişse de toplama sırası, dolayısıyla sonuç, değişmez.
+typedef double dsum_vec __attribute__((vector_size(DSUM_WIDTH * sizeof(double))));
+
+// DSUM_WIDTH şerit için aynı anda TwoSum: s += v, kaybolan kısım c'ye eklenir.
+// Neumaier ile aynı hata terimini verir ama karşılaştırma/seçim gerektirmez;
+// dallanmasız olduğu için düz vektör komutlarına derlenir.
+inline void dsum_accumulate(dsum_vec& s, dsum_vec& c, const dsum_vec& v) {
+    dsum_vec t = s + v;
+    dsum_vec bb = t - s;
+    c += (s - (t - bb)) + (v - bb);
+    s = t;
+}
+
+// Tek bir bloğun DSUM_LANES şeritli compensated toplamı.
+inline dsum_dd dsum_block(const double* x, std::size_t n) {
+    dsum_vec vs[DSUM_ACC] = {}, vc[DSUM_ACC] = {};
+
+    std::size_t i = 0;
+    for (; i + DSUM_LANES <= n; i += DSUM_LANES) {
+        for (std::size_t k = 0; k < DSUM_ACC; k++) {
+            dsum_vec v;
+            std::memcpy(&v, x + i + k * DSUM_WIDTH, sizeof(v));
+            dsum_accumulate(vs[k], vc[k], v);
+        }
+    }
+
+    double s[DSUM_LANES], c[DSUM_LANES];
+    std::memcpy(s, vs, sizeof(s));
+    std::memcpy(c, vc, sizeof(c));
+
+    // Kalan elemanlar sırayla ilk şeritlere dağıtılır.
+    for (std::size_t l = 0; i < n; i++, l++) {
+        dsum_dd r = dsum_two_sum(s[l], x[i]);
+        s[l] = r.hi;
+        c[l] += r.lo;
+    }
+
+    dsum_dd lanes[DSUM_LANES];
+    for (std::size_t l = 0; l < DSUM_LANES; l++) {
+        lanes[l] = dsum_two_sum(s[l], c[l]);
+    }
+    return dsum_tree(lanes, DSUM_LANES);
+}
+
+/*
+ * deterministic_sum() → thread sayısından bağımsız, compensated toplam.
+ * Blokların hangi thread'de hesaplandığı sonucu etkilemez, bu yüzden
+ * schedule ve thread sayısı serbestçe seçilebilir.
+ */
+inline double deterministic_sum(const double* x, std::size_t n) {
+    const long blocks = static_cast<long>((n + DSUM_BLOCK - 1) / DSUM_BLOCK);
+    std::vector<dsum_dd> partial(blocks);
+
+    #pragma omp parallel for schedule(static)
+    for (long b = 0; b < blocks; b++) {
+        std::size_t begin = static_cast<std::size_t>(b) * DSUM_BLOCK;
+        partial[b] = dsum_block(x + begin, std::min(DSUM_BLOCK, n - begin));
+    }
+
+    dsum_dd total = dsum_tree(partial.data(), partial.size());
+    return total.hi + total.lo;
+}
+
+inline double deterministic_sum(const std::vector<double>& v) {
+    return deterministic_sum(v.data(), v.size());
+}
@@ -1,5 +1,9 @@
 #include <omp.h>
 #include <iostream>
+#include <thread>
+#include <vector>
+#include <functional>
+#include "per_thread.hpp"
 using namespace std;
 
 // False Sharing, birden fazla thread'in farklı değişkenlere 
@@ -70,5 +74,40 @@ int main() {
 
     printf("Padding total time: %f\n", end - start);
 
+    // Aynı padding işini elle yapmak yerine per_thread şablonunu
+    // kullanıyoruz. Slot boyutu ve hizalama T'den bağımsız olarak
+    // derleyici tarafından hesaplanır, magic number yok.
+    per_thread<long long> c(2);
 
-}
\ No newline at end of file
+    start = omp_get_wtime();
+    #pragma omp parallel num_threads(2)
+    {
+        int id = omp_get_thread_num();
+        for (int i = 0; i < 100000000; i++) {
+            c[id]++;
+        }
+    }
+    end = omp_get_wtime();
+
+    printf("per_thread (OpenMP) total time: %f, sum = %lld\n",
+           end - start, c.combine(plus<long long>(), 0LL));
+
+    // Aynı şablon std::thread ile de çalışır, thread'e index'i verilir.
+    c.reset();
+    start = omp_get_wtime();
+    {
+        vector<thread> ts;
+        for (int id = 0; id < 2; id++) {
+            ts.emplace_back([&c, id] {
+                for (int i = 0; i < 100000000; i++) {
+                    c[id]++;
+                }
+            });
+        }
+        for (auto& t : ts) t.join();
+    }
+    end = omp_get_wtime();
+
+    printf("per_thread (std::thread) total time: %f, sum = %lld\n",
+           end - start, c.combine(plus<long long>(), 0LL));
+}
@@ -0,0 +1,249 @@
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <fstream>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace chrono;
+
+// false_sharing.cpp iki thread ve iki layout (bitişik / 64 byte pad) ile
+// false sharing'i gösteriyor. Burada aynı deney bir tarama (sweep) haline
+// getiriliyor:
+//   - sayaçlar arası mesafe: 4, 8, 16, 32, 64, 128, 256 byte
+//   - thread sayısı: 2, 4, ... (yerleşimin izin verdiği kadar)
+//   - yerleşim (placement):
+//        smt          → thread'ler aynı çekirdeğin hyper-thread kardeşlerinde
+//                       (L1'i paylaşırlar, coherence trafiği çekirdek içinde)
+//        cross-core   → aynı soketteki farklı çekirdekler
+//        cross-socket → farklı soketler (en pahalı: soketler arası link)
+//        os           → pin yok, işletim sistemi yerleştirir
+//   - güncelleme: plain (volatile load + store) ve atomic (lock xadd)
+//
+// Tablo, her mesafe için sayaç güncellemesi başına ns değerini ve 256
+// byte'a göre yavaşlamayı gösteriyor. Coherence trafiğinin bittiği mesafe
+// satırın ~1x'e düştüğü yerdir. 64 byte ile 128 byte arasında hâlâ fark
+// varsa bu Intel'in adjacent-line (spatial) prefetcher'ının etkisidir:
+// 64 byte'lık line'lar 128 byte'lık çiftler halinde çekilir, komşu line'a
+// yazan thread de çifti sürekli geri çağırır. per_thread.hpp'nin varsayılan
+// olarak 128 byte hizalamasının sebebi budur.
+//
+// Topoloji /sys/devices/system/cpu altından okunur. Makinede olmayan
+// yerleşimler atlanır.
+//
+// g++ -std=c++20 -O2 -pthread false_sharing_sweep.cpp -o false_sharing_sweep
+// ./false_sharing_sweep [iterations_per_thread]
+
+const int DISTANCES[] = {4, 8, 16, 32, 64, 128, 256};
+const int DISTANCE_COUNT = sizeof(DISTANCES) / sizeof(DISTANCES[0]);
+const int MAX_THREADS = 16;
+
+struct Cpu {
+    int id;
+    int core;      // core_id (soket içinde tekil)
+    int socket;    // physical_package_id
+};
+
+static int read_int(const string& path) {
+    ifstream in(path);
+    int v = -1;
+    in >> v;
+    return v;
+}
+
+vector<Cpu> read_topology() {
+    vector<Cpu> cpus;
+    cpu_set_t allowed;
+    sched_getaffinity(0, sizeof(allowed), &allowed);
+    for (int c = 0; c < CPU_SETSIZE; c++) {
+        if (!CPU_ISSET(c, &allowed)) continue;
+        string base = "/sys/devices/system/cpu/cpu" + to_string(c) + "/topology/";
+        cpus.push_back({c, read_int(base + "core_id"), read_int(base + "physical_package_id")});
+    }
+    return cpus;
+}
+
+enum Placement { SMT, CROSS_CORE, CROSS_SOCKET, OS, PLACEMENT_COUNT };
+const char* placement_names[PLACEMENT_COUNT] = {"smt", "cross-core", "cross-socket", "os"};
+
+// Yerleşime göre thread başına CPU listesi. -1 → pin yok.
+// Yeterli CPU yoksa liste threads'ten kısa döner.
+vector<int> pick_cpus(const vector<Cpu>& cpus, Placement p, int threads) {
+    vector<int> out;
+    if (p == OS) {
+        return vector<int>(threads, -1);
+    }
+    if (p == SMT) {
+        // Aynı (socket, core) çiftine düşen ilk iki CPU. Bir çekirdekte genelde
+        // 2 hyper-thread olduğu için SMT sadece 2 thread ile ölçülür.
+        if (threads != 2) return {};
+        for (size_t i = 0; i < cpus.size(); i++) {
+            for (size_t j = i + 1; j < cpus.size(); j++) {
+                if (cpus[i].socket == cpus[j].socket && cpus[i].core == cpus[j].core) {
+                    return {cpus[i].id, cpus[j].id};
+                }
+            }
+        }
+        return {};
+    }
+    if (p == CROSS_CORE) {
+        // İlk soketteki farklı çekirdeklerden birer CPU.
+        int socket = cpus.empty() ? 0 : cpus[0].socket;
+        vector<int> used_cores;
+        for (const Cpu& c : cpus) {
+            if (c.socket != socket || find(used_cores.begin(), used_cores.end(), c.core) != used_cores.end()) continue;
+            used_cores.push_back(c.core);
+            out.push_back(c.id);
+            if ((int)out.size() == threads) break;
+        }
+        return out;
+    }
+    // CROSS_SOCKET: soketler arasında dönüşümlü, her sokette farklı çekirdek.
+    vector<int> sockets;
+    for (const Cpu& c : cpus) {
+        if (find(sockets.begin(), sockets.end(), c.socket) == sockets.end()) sockets.push_back(c.socket);
+    }
+    if (sockets.size() < 2) return {};
+    vector<vector<int>> per_socket(sockets.size());
+    for (size_t s = 0; s < sockets.size(); s++) {
+        vector<int> used_cores;
+        for (const Cpu& c : cpus) {
+            if (c.socket != sockets[s] || find(used_cores.begin(), used_cores.end(), c.core) != used_cores.end()) continue;
+            used_cores.push_back(c.core);
+            per_socket[s].push_back(c.id);
+        }
+    }
+    for (size_t k = 0; (int)out.size() < threads; k++) {
+        bool any = false;
+        for (size_t s = 0; s < sockets.size() && (int)out.size() < threads; s++) {
+            if (k < per_socket[s].size()) {
+                out.push_back(per_socket[s][k]);
+                any = true;
+            }
+        }
+        if (!any) break;
+    }
+    return out;
+}
+
+static void pin(int cpu) {
+    if (cpu < 0) return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+// Sayaçlar base + t * distance adresinde. 4 byte'lık sayaç, en küçük
+// mesafede bile kendi alanına sığsın diye.
+// Dönen değer: güncelleme başına ortalama ns (en yavaş thread'e göre).
+double run(const vector<int>& cpus, int distance, bool atomic_update, long iters) {
+    const int threads = cpus.size();
+    alignas(4096) static char buffer[MAX_THREADS * 256 + 4096];
+    fill(begin(buffer), end(buffer), 0);
+
+    atomic<int> ready{0};
+    atomic<bool> go{false};
+    vector<double> seconds(threads);
+    vector<thread> ts;
+
+    for (int t = 0; t < threads; t++) {
+        ts.emplace_back([&, t] {
+            pin(cpus[t]);
+            uint32_t* counter = reinterpret_cast<uint32_t*>(buffer + t * distance);
+            ready.fetch_add(1);
+            while (!go.load(memory_order_acquire)) {}
+
+            auto t0 = steady_clock::now();
+            if (atomic_update) {
+                atomic_ref<uint32_t> c(*counter);
+                for (long i = 0; i < iters; i++) {
+                    c.fetch_add(1, memory_order_relaxed);
+                }
+            } else {
+                // volatile: her artırma gerçekten belleğe yazılsın, register'da kalmasın.
+                volatile uint32_t* c = counter;
+                for (long i = 0; i < iters; i++) {
+                    *c = *c + 1;
+                }
+            }
+            seconds[t] = duration<double>(steady_clock::now() - t0).count();
+        });
+    }
+    while (ready.load() != threads) {}
+    go.store(true, memory_order_release);
+    for (auto& t : ts) t.join();
+
+    return *max_element(seconds.begin(), seconds.end()) / iters * 1e9;
+}
+
+int main(int argc, char** argv) {
+    long iters = argc > 1 ? atol(argv[1]) : 20000000;
+    vector<Cpu> cpus = read_topology();
+
+    int sockets = 0, cores = 0;
+    {
+        vector<pair<int, int>> seen;
+        vector<int> seen_sockets;
+        for (const Cpu& c : cpus) {
+            if (find(seen.begin(), seen.end(), make_pair(c.socket, c.core)) == seen.end()) seen.push_back({c.socket, c.core});
+            if (find(seen_sockets.begin(), seen_sockets.end(), c.socket) == seen_sockets.end()) seen_sockets.push_back(c.socket);
+        }
+        sockets = seen_sockets.size();
+        cores = seen.size();
+    }
+    printf("%zu CPUs, %d cores, %d sockets, %ld updates per thread\n", cpus.size(), cores, sockets, iters);
+    printf("ns per update (slowest thread); x = slowdown vs 256 B distance\n");
+
+    for (int p = 0; p < PLACEMENT_COUNT; p++) {
+        for (int threads = 2; threads <= MAX_THREADS; threads *= 2) {
+            vector<int> chosen = pick_cpus(cpus, (Placement)p, threads);
+            if ((int)chosen.size() < threads) {
+                if (threads == 2) printf("\n=== %s: not available on this machine ===\n", placement_names[p]);
+                break;
+            }
+            // Pin'siz durumda CPU sayısından fazla thread anlamsız.
+            if (p == OS && threads > max<int>(2, cpus.size())) break;
+
+            printf("\n=== %s, %d threads (cpus", placement_names[p], threads);
+            for (int c : chosen) {
+                if (c >= 0) printf(" %d", c); else { printf(" any"); break; }
+            }
+            printf(") ===\n");
+            printf("%8s %12s %8s %12s %8s\n", "distance", "plain ns", "x", "atomic ns", "x");
+
+            // Her nokta 3 ölçümün en iyisi (kesintilerden etkilenmesin).
+            double plain[DISTANCE_COUNT], atom[DISTANCE_COUNT];
+            for (int d = 0; d < DISTANCE_COUNT; d++) {
+                plain[d] = atom[d] = 1e30;
+                for (int r = 0; r < 3; r++) {
+                    plain[d] = min(plain[d], run(chosen, DISTANCES[d], false, iters));
+                    atom[d] = min(atom[d], run(chosen, DISTANCES[d], true, iters));
+                }
+            }
+            const int last = DISTANCE_COUNT - 1;
+            for (int d = 0; d < DISTANCE_COUNT; d++) {
+                printf("%6d B %12.2f %7.2fx %12.2f %7.2fx\n", DISTANCES[d],
+                       plain[d], plain[d] / plain[last], atom[d], atom[d] / atom[last]);
+            }
+
+            // Özet: yavaşlamanın %15'in altına indiği ilk mesafe.
+            int clean = last;
+            for (int d = last; d >= 0 && plain[d] <= plain[last] * 1.15; d--) clean = d;
+            const int d64 = 4, d128 = 5;
+            printf("coherence traffic gone from %d B; 64 B vs 128 B: %.2fx plain, %.2fx atomic%s\n",
+                   DISTANCES[clean], plain[d64] / plain[d128], atom[d64] / atom[d128],
+                   plain[d64] > plain[d128] * 1.10 ? "  <- adjacent-line prefetch effect" : "");
+        }
+    }
+}
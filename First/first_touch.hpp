@@ -0,0 +1,91 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include <omp.h>
+
+/*
+ * first_touch
+ * Linux bir sayfayı malloc/new anında değil, ilk yazıldığı anda fiziksel
+ * belleğe bağlar ve sayfayı yazan thread'in çalıştığı NUMA node'undan
+ * alır (first-touch policy). main.cpp'deki
+ *     vector<int> data(N, 5);
+ * bütün diziyi ana thread'de doldurur; çok soketli bir makinede bütün
+ * sayfalar ana thread'in node'una düşer. Sonraki "parallel for" döngülerinde
+ * diğer soketteki thread'ler her erişimde uzak belleğe gider.
+ *
+ * Burada iki parça var:
+ *   - first_touch_allocator<T>: construct() argümansız çağrılırsa
+ *     value-initialize (sıfırlama) yerine default-initialize yapar. int gibi
+ *     trivial tipler için bu hiçbir şey yazmamak demektir, yani vector(n)
+ *     sayfalara dokunmadan sadece adres aralığını ayırır.
+ *   - first_touch_init / make_first_touch_vector: elemanlar
+ *     "parallel for schedule(static)" içinde yazılır. Her sayfa, daha sonra
+ *     aynı schedule ile o sayfayı işleyecek thread tarafından dokunulur.
+ *
+ * Sayfaların yerel kalması için hesaplama döngüleri de schedule(static)
+ * kullanmalı, aynı thread sayısı ve aynı iterasyon aralığı ile çalışmalı ve
+ * thread'ler bağlı (OMP_PROC_BIND=close/spread) olmalıdır.
+ * Tek node'lu makinede her şey aynı node'a düşer; davranış ve sonuç
+ * normal vector ile aynıdır, sadece ilk doldurma paralel yapılmış olur.
+ */
+
+// Sayfa sınırında hizalanır, böylece ilk sayfa başka bir nesneyle paylaşılmaz.
+inline constexpr std::size_t first_touch_alignment = 4096;
+
+template <typename T>
+class first_touch_allocator {
+public:
+    using value_type = T;
+
+    first_touch_allocator() noexcept = default;
+
+    template <typename U>
+    first_touch_allocator(const first_touch_allocator<U>&) noexcept {}
+
+    // Büyük bloklar için glibc mmap kullanır: sayfalar burada dokunulmaz.
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(first_touch_alignment)));
+    }
+
+    void deallocate(T* p, std::size_t) noexcept {
+        ::operator delete(p, std::align_val_t(first_touch_alignment));
+    }
+
+    // vector(n) ve resize(n) bunu çağırır: "new (p) U" default-initialize
+    // eder, trivial tiplerde belleğe hiçbir şey yazılmaz.
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args) {
+        if constexpr (sizeof...(Args) == 0) {
+            ::new (static_cast<void*>(p)) U;
+        } else {
+            ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+        }
+    }
+
+    template <typename U>
+    bool operator==(const first_touch_allocator<U>&) const noexcept { return true; }
+};
+
+template <typename T>
+using first_touch_vector = std::vector<T, first_touch_allocator<T>>;
+
+// p[i] = init(i), sonraki hesaplama döngüleriyle aynı static dağılımla.
+template <typename T, typename Init>
+void first_touch_init(T* p, std::size_t n, Init init) {
+    const long count = static_cast<long>(n);
+    #pragma omp parallel for schedule(static)
+    for (long i = 0; i < count; i++) {
+        p[i] = init(i);
+    }
+}
+
+// vector<T>(n, value)'nun first-touch karşılığı.
+template <typename T>
+first_touch_vector<T> make_first_touch_vector(std::size_t n, const T& value) {
+    first_touch_vector<T> v(n);   // sadece adres ayrılır
+    first_touch_init(v.data(), n, [&value](long) { return value; });
+    return v;
+}
@@ -2,8 +2,9 @@
 #include <iostream>
 #include <vector>
 #include <chrono>
-#include <windows.h>
 #include <thread>
+#include "first_touch.hpp"
+#include "placement.hpp"
 
 
 using namespace std;
@@ -58,13 +59,14 @@ int main() {
     // gelen threadid değildir. 
     // Thread id ye ulaşmak için işletim sisteminin kendi
     // thread id kodunu kullanmanız gerekir.
-    // Benim kodum şu an Windows üzerinde çalıştığı için
-    // GetCurrentThreadId fonksiyonu windows.h üzerinden çağrılır.
+    // current_tid() Linux'ta gettid, Windows'ta GetCurrentThreadId
+    // çağırır (bkz. placement.hpp). Thread'lerin hangi CPU/çekirdek/
+    // NUMA node üzerinde olduğunun tam raporu için placement_report.cpp.
     #pragma omp parallel
     {
         int omp_id = omp_get_thread_num();
-        DWORD os_tid = GetCurrentThreadId();
-        printf("OpenMP thread %d -> OS thread ID: %lu\n", omp_id, os_tid);
+        long os_tid = current_tid();
+        printf("OpenMP thread %d -> OS thread ID: %ld\n", omp_id, os_tid);
     }
     
 
@@ -155,7 +157,11 @@ int main() {
     // yazıyoruz.
     int total = 0;
     int N = 100000000;
-    vector<int> data(N, 5);
+    // vector<int> data(N, 5) bütün sayfaları ana thread'de doldururdu.
+    // Burada elemanlar aşağıdaki döngülerle aynı static dağılımla
+    // paralel yazılır, sayfalar onları işleyecek thread'in node'una düşer.
+    // (bkz. first_touch.hpp)
+    auto data = make_first_touch_vector<int>(N, 5);
 
     #pragma omp parallel for
     for (int i = 0; i < N; i++) {
@@ -0,0 +1,304 @@
+#include <omp.h>
+#include <iostream>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <memory>
+#include <cstdio>
+
+#include "per_thread.hpp"
+
+using namespace std;
+
+// Şimdiye kadarki OpenMP örnekleri hep "parallel for" kullanıyor. Ağaç
+// şeklindeki (recursive) işlerde iterasyon sayısı baştan belli değildir;
+// burada "omp task" ile iş her bölünmede yeni bir task olarak üretilir ve
+// boşta kalan thread'ler task kuyruğundan iş alır.
+//
+// Task oluşturmanın bir maliyeti var (task nesnesi, kuyruk, senkronizasyon).
+// Ağacın yaprağına kadar her çağrıyı task yapmak bu maliyeti iş miktarının
+// çok üstüne çıkarır. Bu yüzden belli bir derinlikten (cutoff) sonra seri
+// koda geçilir. Üç farklı yol ölçülüyor:
+//   if(depth < cutoff)    → koşul yanlışsa task hemen, yaratan thread'de
+//                           çalışır (undeferred). Task nesnesi yine oluşur.
+//   final(depth >= cutoff)→ bu task'tan sonraki bütün task'lar "included"
+//                           olur; omp_in_final() ile seri koda geçilebilir.
+//   manual                → cutoff'tan sonra doğrudan seri fonksiyon çağrılır.
+//
+// Workload'lar:
+//   fib          → recursive Fibonacci, taskwait
+//   quicksort    → paralel quicksort, taskgroup
+//   tree reduce  → pointer'lı ikili ağaçta toplam, taskwait
+//   taskloop     → dizi toplamı, taskloop grainsize + reduction
+//
+// Her cutoff için süre, seri referansa göre hız ve oluşturulan task sayısı
+// yazdırılır. Çok küçük cutoff → az task, paralellik yok; çok büyük
+// cutoff → task overhead'i baskın.
+//
+// g++ -std=c++20 -O2 -fopenmp omp_tasks.cpp -o omp_tasks
+// ./omp_tasks
+
+const int RUNS = 3;
+
+// Task sayacı: her thread kendi slotunu artırır (tek atomic sayaç
+// ölçtüğümüz overhead'i bozardı).
+per_thread<long long>* task_count;
+
+static void count_task() {
+    (*task_count)[omp_get_thread_num()]++;
+}
+
+static long long take_task_count() {
+    long long n = task_count->combine([](long long a, long long b) { return a + b; }, 0LL);
+    task_count->reset(0);
+    return n;
+}
+
+template <typename F>
+double best_time(F f) {
+    double best = 1e30;
+    for (int r = 0; r < RUNS; r++) {
+        double t0 = omp_get_wtime();
+        f();
+        best = min(best, omp_get_wtime() - t0);
+    }
+    return best;
+}
+
+// ------------------------------------------------------------------
+// fib
+// ------------------------------------------------------------------
+
+long fib_serial(int n) {
+    return n < 2 ? n : fib_serial(n - 1) + fib_serial(n - 2);
+}
+
+long fib_if(int n, int depth, int cutoff) {
+    if (n < 2) return n;
+    long x, y;
+    #pragma omp task shared(x) if(depth < cutoff)
+    {
+        count_task();
+        x = fib_if(n - 1, depth + 1, cutoff);
+    }
+    y = fib_if(n - 2, depth + 1, cutoff);
+    #pragma omp taskwait
+    return x + y;
+}
+
+long fib_final(int n, int depth, int cutoff) {
+    if (n < 2) return n;
+    // final task'ın içindeyken yeni task üretmenin anlamı yok.
+    if (omp_in_final()) return fib_serial(n);
+    long x, y;
+    #pragma omp task shared(x) final(depth + 1 >= cutoff)
+    {
+        count_task();
+        x = fib_final(n - 1, depth + 1, cutoff);
+    }
+    y = fib_final(n - 2, depth + 1, cutoff);
+    #pragma omp taskwait
+    return x + y;
+}
+
+long fib_manual(int n, int depth, int cutoff) {
+    if (depth >= cutoff) return fib_serial(n);
+    if (n < 2) return n;
+    long x, y;
+    #pragma omp task shared(x)
+    {
+        count_task();
+        x = fib_manual(n - 1, depth + 1, cutoff);
+    }
+    y = fib_manual(n - 2, depth + 1, cutoff);
+    #pragma omp taskwait
+    return x + y;
+}
+
+// ------------------------------------------------------------------
+// quicksort
+// ------------------------------------------------------------------
+
+static int* partition_mid(int* lo, int* hi) {
+    // Ortanca-of-üç pivot, Hoare bölmesi.
+    int* mid = lo + (hi - lo) / 2;
+    int a = *lo, b = *mid, c = *(hi - 1);
+    int pivot = max(min(a, b), min(max(a, b), c));
+    int* i = lo - 1;
+    int* j = hi;
+    while (true) {
+        do { i++; } while (*i < pivot);
+        do { j--; } while (*j > pivot);
+        if (i >= j) return j + 1;
+        swap(*i, *j);
+    }
+}
+
+void quicksort_serial(int* lo, int* hi) {
+    while (hi - lo > 32) {
+        int* m = partition_mid(lo, hi);
+        quicksort_serial(lo, m);
+        lo = m;
+    }
+    // Küçük parçalar için insertion sort
+    for (int* i = lo + 1; i < hi; i++) {
+        int v = *i;
+        int* j = i;
+        for (; j > lo && *(j - 1) > v; j--) *j = *(j - 1);
+        *j = v;
+    }
+}
+
+void quicksort_tasks(int* lo, int* hi, int depth, int cutoff) {
+    if (depth >= cutoff || hi - lo < 1024) {
+        quicksort_serial(lo, hi);
+        return;
+    }
+    int* m = partition_mid(lo, hi);
+    // taskgroup: içinde üretilen task'ların (ve onların alt task'larının)
+    // hepsi bitene kadar bekler.
+    #pragma omp taskgroup
+    {
+        #pragma omp task
+        {
+            count_task();
+            quicksort_tasks(lo, m, depth + 1, cutoff);
+        }
+        quicksort_tasks(m, hi, depth + 1, cutoff);
+    }
+}
+
+// ------------------------------------------------------------------
+// tree reduction
+// ------------------------------------------------------------------
+
+struct Node {
+    long value;
+    unique_ptr<Node> left, right;
+};
+
+// Düğümler farklı zamanlarda ayrıldığı için bellekte dağınık durur,
+// pointer takibi gerçek bir ağaçtaki gibi cache miss üretir.
+unique_ptr<Node> build_tree(int depth, mt19937& rng) {
+    if (depth < 0) return nullptr;
+    auto n = make_unique<Node>();
+    n->value = rng() % 100;
+    n->left = build_tree(depth - 1, rng);
+    n->right = build_tree(depth - 1, rng);
+    return n;
+}
+
+long tree_sum_serial(const Node* n) {
+    if (!n) return 0;
+    return n->value + tree_sum_serial(n->left.get()) + tree_sum_serial(n->right.get());
+}
+
+long tree_sum_tasks(const Node* n, int depth, int cutoff) {
+    if (!n) return 0;
+    if (depth >= cutoff) return tree_sum_serial(n);
+    long l, r;
+    #pragma omp task shared(l)
+    {
+        count_task();
+        l = tree_sum_tasks(n->left.get(), depth + 1, cutoff);
+    }
+    r = tree_sum_tasks(n->right.get(), depth + 1, cutoff);
+    #pragma omp taskwait
+    return n->value + l + r;
+}
+
+// ------------------------------------------------------------------
+
+template <typename Body>
+void sweep(const char* title, double serial, int max_cutoff, Body body) {
+    printf("\n=== %s (serial %.2f ms) ===\n", title, serial * 1e3);
+    printf("%7s %12s %9s %12s\n", "cutoff", "time", "speedup", "tasks");
+    for (int cutoff = 0; cutoff <= max_cutoff; cutoff += (cutoff < 8 ? 1 : 4)) {
+        double t = best_time([&] {
+            #pragma omp parallel
+            #pragma omp single
+            body(cutoff);
+        });
+        long long tasks = take_task_count() / RUNS;
+        printf("%7d %9.2f ms %8.2fx %12lld\n", cutoff, t * 1e3, serial / t, tasks);
+    }
+}
+
+int main() {
+    per_thread<long long> counter(omp_get_max_threads(), 0);
+    task_count = &counter;
+    printf("%d threads\n", omp_get_max_threads());
+
+    // fib
+    const int FIB_N = 32;
+    long expected = fib_serial(FIB_N);
+    double serial = best_time([&] { fib_serial(FIB_N); });
+    long result = 0;
+    sweep("fib(32), if(depth < cutoff)", serial, 20, [&](int c) { result = fib_if(FIB_N, 0, c); });
+    sweep("fib(32), final(depth >= cutoff)", serial, 20, [&](int c) { result = fib_final(FIB_N, 0, c); });
+    sweep("fib(32), manual cutoff", serial, 20, [&](int c) { result = fib_manual(FIB_N, 0, c); });
+    printf("fib check: %s\n", result == expected ? "ok" : "WRONG");
+
+    // quicksort
+    const int SORT_N = 10000000;
+    vector<int> input(SORT_N), work;
+    mt19937 rng(1);
+    for (int& v : input) v = rng();
+    serial = 1e30;
+    for (int r = 0; r < RUNS; r++) {
+        work = input;
+        double t0 = omp_get_wtime();
+        quicksort_serial(work.data(), work.data() + SORT_N);
+        serial = min(serial, omp_get_wtime() - t0);
+    }
+    printf("\n=== quicksort 10M ints (serial %.2f ms), taskgroup ===\n", serial * 1e3);
+    printf("%7s %12s %9s %12s\n", "cutoff", "time", "speedup", "tasks");
+    for (int cutoff = 0; cutoff <= 16; cutoff += 2) {
+        double best = 1e30;
+        for (int r = 0; r < RUNS; r++) {
+            work = input;   // kopyalama ölçüme dahil değil
+            double t0 = omp_get_wtime();
+            #pragma omp parallel
+            #pragma omp single
+            quicksort_tasks(work.data(), work.data() + SORT_N, 0, cutoff);
+            best = min(best, omp_get_wtime() - t0);
+        }
+        long long tasks = take_task_count() / RUNS;
+        printf("%7d %9.2f ms %8.2fx %12lld%s\n", cutoff, best * 1e3, serial / best, tasks,
+               is_sorted(work.begin(), work.end()) ? "" : "  NOT SORTED");
+    }
+
+    // tree reduction
+    mt19937 tree_rng(2);
+    auto root = build_tree(21, tree_rng);   // ~4M düğüm
+    long tree_expected = tree_sum_serial(root.get());
+    serial = best_time([&] { tree_sum_serial(root.get()); });
+    long tree_result = 0;
+    sweep("tree reduction, 2^22 nodes", serial, 16, [&](int c) { tree_result = tree_sum_tasks(root.get(), 0, c); });
+    printf("tree check: %s\n", tree_result == tree_expected ? "ok" : "WRONG");
+
+    // taskloop
+    const long LOOP_N = 50000000;
+    vector<long> arr(LOOP_N, 1);
+    serial = best_time([&] {
+        volatile long s = 0;
+        long acc = 0;
+        for (long i = 0; i < LOOP_N; i++) acc += arr[i];
+        s = acc;
+        (void)s;
+    });
+    printf("\n=== taskloop sum of 50M longs (serial %.2f ms) ===\n", serial * 1e3);
+    printf("%10s %12s %9s %12s\n", "grainsize", "time", "speedup", "tasks");
+    for (long grain = 1 << 8; grain <= LOOP_N; grain *= 8) {
+        long sum = 0;
+        double t = best_time([&] {
+            sum = 0;
+            #pragma omp parallel
+            #pragma omp single
+            #pragma omp taskloop grainsize(grain) reduction(+:sum)
+            for (long i = 0; i < LOOP_N; i++) sum += arr[i];
+        });
+        printf("%10ld %9.2f ms %8.2fx %12ld%s\n", grain, t * 1e3, serial / t,
+               (LOOP_N + grain - 1) / grain, sum == LOOP_N ? "" : "  WRONG");
+    }
+}
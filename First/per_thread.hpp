@@ -0,0 +1,104 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+/*
+ * per_thread<T>
+ * false_sharing.cpp içindeki PaddedInt (char pad[60]) ve pi_comparison.c
+ * içindeki sum[NUM_THREADS][PAD] aynı işi elle yapıyor: her thread'in
+ * değişkenini ayrı bir cache line'a koymak. Buradaki şablon bunu her T için
+ * genel hale getirir.
+ *
+ * - Her slot alignas(Align) ile hizalanır. C++'ta bir tipin boyutu her zaman
+ *   hizalamasının katıdır, yani T ne kadar büyük ya da küçük olursa olsun
+ *   iki slot asla aynı cache line'ı paylaşmaz. Elle pad hesaplamaya gerek yok.
+ * - Varsayılan Align 128 byte: Intel'in adjacent-line prefetcher'ı cache
+ *   line'ları çift olarak (128 byte) çeker. 64 byte aralıklı iki sayaç farklı
+ *   line'larda olsa bile prefetcher yüzünden yine birbirini etkileyebilir.
+ *   Sadece tek line yeterliyse per_thread<T, cache_line_size> kullanılabilir.
+ * - combine(op, init) bütün slotları sırayla (0, 1, 2, ...) birleştirir.
+ *   Sıra sabit olduğu için floating-point sonuçları her çalıştırmada aynıdır.
+ *
+ * OpenMP ile:      acc[omp_get_thread_num()] += ...
+ * std::thread ile: thread'e kendi index'i verilir, acc[id] += ...
+ */
+
+// GCC bu sabitin -mtune'a göre değişebileceği için ABI uyarısı veriyor,
+// burada sadece hizalama için kullanıldığından uyarı kapatılıyor.
+#ifdef __cpp_lib_hardware_interference_size
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+#endif
+inline constexpr std::size_t cache_line_size = std::hardware_destructive_interference_size;
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#else
+inline constexpr std::size_t cache_line_size = 64;
+#endif
+
+template <typename T, std::size_t Align = 2 * cache_line_size>
+class per_thread {
+    struct alignas(Align) Slot {
+        T value;
+    };
+    static_assert(sizeof(Slot) % Align == 0, "slot must fill whole cache lines");
+
+public:
+    // Slotlar default-construct edilir; std::atomic gibi kopyalanamayan
+    // tipler de bu şekilde kullanılabilir.
+    explicit per_thread(std::size_t threads)
+        : slots_(threads) {}
+
+    per_thread(std::size_t threads, const T& init)
+        : slots_(threads, Slot{init}) {}
+
+    std::size_t size() const { return slots_.size(); }
+
+    T& operator[](std::size_t id) { return slots_[id].value; }
+    const T& operator[](std::size_t id) const { return slots_[id].value; }
+
+    // Bütün slotları aynı değere döndürür (örneğin bir sonraki ölçümden önce).
+    void reset(const T& value = T()) {
+        for (Slot& s : slots_) {
+            s.value = value;
+        }
+    }
+
+    // init op slot[0] op slot[1] ... şeklinde soldan sağa birleştirir.
+    template <typename Op>
+    T combine(Op op, T init) const {
+        for (const Slot& s : slots_) {
+            init = op(std::move(init), s.value);
+        }
+        return init;
+    }
+
+    // İlk slot başlangıç değeri olarak kullanılır (örneğin min/max için).
+    // En az bir slot gerekir; boş olabilecekse combine(op, init) kullanılmalı.
+    template <typename Op>
+    T combine(Op op) const {
+        assert(!slots_.empty() && "combine(op) needs at least one slot");
+        T result = slots_[0].value;
+        for (std::size_t i = 1; i < slots_.size(); i++) {
+            result = op(std::move(result), slots_[i].value);
+        }
+        return result;
+    }
+
+    template <typename F>
+    void for_each(F f) {
+        for (Slot& s : slots_) {
+            f(s.value);
+        }
+    }
+
+private:
+    // C++17'den beri std::allocator over-aligned tipler için
+    // hizalı operator new kullanır, bu yüzden vector güvenle kullanılabilir.
+    std::vector<Slot> slots_;
+};
@@ -1,5 +1,19 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
 #include <omp.h>
+#if defined(__x86_64__) || defined(__i386__)
+#define PI_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#include <x86intrin.h>
+#endif
+
+// gcc -O2 -fopenmp pi_comparison.c -o pi_comparison -lm
+// Not: -mavx2 / -mavx512f gerekmez, SIMD kernel'ler target attribute
+// ile derlenir ve hangisinin çalışacağına çalışma anında karar verilir.
+// x86 dışındaki mimarilerde (ARM vb.) sadece skaler kernel derlenir.
 
 #define NUM_THREADS 4
 #define PAD 8                 
@@ -122,13 +136,384 @@ void pi_atomic() {
     printf("[4] Atomic          : pi = %.10f | time = %.4f s\n", pi, t1 - t0);
 }
 
+// 5) Bloklu + SIMD
+// Yukarıdaki dört örnek i += nthrds ile döngüyü threadlere dağıtıyor.
+// Bu durumda bir thread'in ardışık iki iterasyonu bellekte/sayı doğrusunda
+// ardışık değil ve derleyici döngüyü vektörleştiremiyor.
+// Burada her thread [begin, end) şeklinde bitişik bir blok alıyor ve bloğu
+// AVX2 veya AVX-512 FMA kernel'i ile hesaplıyor. Toplama tek bir register'a
+// yapılırsa her add bir öncekini bekler (latency bound), bu yüzden 4 ayrı
+// accumulator kullanılıyor ve en sonda birleştiriliyor.
+
+// İterasyon başına sayılan işlem: (i+0.5), *step, x*x+1 (FMA = 2), 4/den, sum+=
+#define FLOPS_PER_STEP 6
+
+typedef double (*pi_kernel_fn)(long begin, long end, double step);
+
+static double pi_block_scalar(long begin, long end, double step) {
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    long i = begin;
+    for (; i + 4 <= end; i += 4) {
+        double x0 = (i + 0.5) * step, x1 = (i + 1.5) * step;
+        double x2 = (i + 2.5) * step, x3 = (i + 3.5) * step;
+        s0 += 4.0 / (1.0 + x0 * x0);
+        s1 += 4.0 / (1.0 + x1 * x1);
+        s2 += 4.0 / (1.0 + x2 * x2);
+        s3 += 4.0 / (1.0 + x3 * x3);
+    }
+    for (; i < end; i++) {
+        double x = (i + 0.5) * step;
+        s0 += 4.0 / (1.0 + x * x);
+    }
+    return (s0 + s1) + (s2 + s3);
+}
+
+#ifdef PI_X86
+__attribute__((target("avx2,fma")))
+static double pi_block_avx2(long begin, long end, double step) {
+    const __m256d one  = _mm256_set1_pd(1.0);
+    const __m256d four = _mm256_set1_pd(4.0);
+    const __m256d inc  = _mm256_set1_pd(4.0);
+    const __m256d vstep = _mm256_set1_pd(step);
+    // idx = i + 0.5 her lane için; tam sayılar 2^53'e kadar double'da kesin.
+    __m256d idx = _mm256_add_pd(_mm256_set1_pd((double)begin), _mm256_set_pd(3.5, 2.5, 1.5, 0.5));
+    __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+    __m256d acc2 = _mm256_setzero_pd(), acc3 = _mm256_setzero_pd();
+
+    long i = begin;
+    for (; i + 16 <= end; i += 16) {
+        __m256d x0 = _mm256_mul_pd(idx, vstep); idx = _mm256_add_pd(idx, inc);
+        __m256d x1 = _mm256_mul_pd(idx, vstep); idx = _mm256_add_pd(idx, inc);
+        __m256d x2 = _mm256_mul_pd(idx, vstep); idx = _mm256_add_pd(idx, inc);
+        __m256d x3 = _mm256_mul_pd(idx, vstep); idx = _mm256_add_pd(idx, inc);
+        acc0 = _mm256_add_pd(acc0, _mm256_div_pd(four, _mm256_fmadd_pd(x0, x0, one)));
+        acc1 = _mm256_add_pd(acc1, _mm256_div_pd(four, _mm256_fmadd_pd(x1, x1, one)));
+        acc2 = _mm256_add_pd(acc2, _mm256_div_pd(four, _mm256_fmadd_pd(x2, x2, one)));
+        acc3 = _mm256_add_pd(acc3, _mm256_div_pd(four, _mm256_fmadd_pd(x3, x3, one)));
+    }
+    __m256d acc = _mm256_add_pd(_mm256_add_pd(acc0, acc1), _mm256_add_pd(acc2, acc3));
+    __m128d lo = _mm256_castpd256_pd128(acc), hi = _mm256_extractf128_pd(acc, 1);
+    lo = _mm_add_pd(lo, hi);
+    double sum = _mm_cvtsd_f64(_mm_add_sd(lo, _mm_unpackhi_pd(lo, lo)));
+    return sum + pi_block_scalar(i, end, step);
+}
+
+__attribute__((target("avx512f")))
+static double pi_block_avx512(long begin, long end, double step) {
+    const __m512d one  = _mm512_set1_pd(1.0);
+    const __m512d four = _mm512_set1_pd(4.0);
+    const __m512d inc  = _mm512_set1_pd(8.0);
+    const __m512d vstep = _mm512_set1_pd(step);
+    __m512d idx = _mm512_add_pd(_mm512_set1_pd((double)begin),
+                                _mm512_set_pd(7.5, 6.5, 5.5, 4.5, 3.5, 2.5, 1.5, 0.5));
+    __m512d acc0 = _mm512_setzero_pd(), acc1 = _mm512_setzero_pd();
+    __m512d acc2 = _mm512_setzero_pd(), acc3 = _mm512_setzero_pd();
+
+    long i = begin;
+    for (; i + 32 <= end; i += 32) {
+        __m512d x0 = _mm512_mul_pd(idx, vstep); idx = _mm512_add_pd(idx, inc);
+        __m512d x1 = _mm512_mul_pd(idx, vstep); idx = _mm512_add_pd(idx, inc);
+        __m512d x2 = _mm512_mul_pd(idx, vstep); idx = _mm512_add_pd(idx, inc);
+        __m512d x3 = _mm512_mul_pd(idx, vstep); idx = _mm512_add_pd(idx, inc);
+        acc0 = _mm512_add_pd(acc0, _mm512_div_pd(four, _mm512_fmadd_pd(x0, x0, one)));
+        acc1 = _mm512_add_pd(acc1, _mm512_div_pd(four, _mm512_fmadd_pd(x1, x1, one)));
+        acc2 = _mm512_add_pd(acc2, _mm512_div_pd(four, _mm512_fmadd_pd(x2, x2, one)));
+        acc3 = _mm512_add_pd(acc3, _mm512_div_pd(four, _mm512_fmadd_pd(x3, x3, one)));
+    }
+    __m512d acc = _mm512_add_pd(_mm512_add_pd(acc0, acc1), _mm512_add_pd(acc2, acc3));
+    return _mm512_reduce_add_pd(acc) + pi_block_scalar(i, end, step);
+}
+
+// CPUID sadece işlemcinin komutu desteklediğini söyler. İşletim sisteminin
+// geniş register'ları (YMM/ZMM) context switch'te kaydettiğini XGETBV ile
+// ayrıca kontrol etmek gerekir, yoksa komut çalışır ama register'lar bozulur.
+static unsigned long long read_xcr0(void) {
+    unsigned int lo, hi;
+    __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return ((unsigned long long)hi << 32) | lo;
+}
+
+// Seçilen kernel ve çekirdek başına çevrim başına düşen tepe FLOP sayısı
+// (2 FMA birimi varsayımıyla: 2 birim * lane sayısı * 2 işlem).
+static pi_kernel_fn select_pi_kernel(const char** name, int* peak_flops_per_cycle) {
+    unsigned int a, b, c, d;
+    int avx2 = 0, fma = 0, avx512 = 0, os_ymm = 0, os_zmm = 0;
+
+    if (__get_cpuid(1, &a, &b, &c, &d)) {
+        fma = (c >> 12) & 1;
+        if ((c >> 27) & 1) {   // OSXSAVE
+            unsigned long long xcr0 = read_xcr0();
+            os_ymm = (xcr0 & 0x6) == 0x6;       // SSE + AVX state
+            os_zmm = (xcr0 & 0xe6) == 0xe6;     // + opmask, ZMM_Hi256, Hi16_ZMM
+        }
+    }
+    if (__get_cpuid_count(7, 0, &a, &b, &c, &d)) {
+        avx2 = (b >> 5) & 1;
+        avx512 = (b >> 16) & 1;
+    }
+
+    if (avx512 && os_zmm) {
+        *name = "AVX-512";
+        *peak_flops_per_cycle = 2 * 8 * 2;
+        return pi_block_avx512;
+    }
+    if (avx2 && fma && os_ymm) {
+        *name = "AVX2+FMA";
+        *peak_flops_per_cycle = 2 * 4 * 2;
+        return pi_block_avx2;
+    }
+    *name = "scalar";
+    *peak_flops_per_cycle = 2 * 2;
+    return pi_block_scalar;
+}
+
+// Nominal frekans olarak TSC frekansı kullanılıyor (turbo hesaba katılmaz).
+static double tsc_ghz(void) {
+    double t0 = omp_get_wtime();
+    unsigned long long c0 = __rdtsc();
+    while (omp_get_wtime() - t0 < 0.05) {}
+    return (double)(__rdtsc() - c0) / ((omp_get_wtime() - t0) * 1e9);
+}
+#else
+static pi_kernel_fn select_pi_kernel(const char** name, int* peak_flops_per_cycle) {
+    *name = "scalar";
+    *peak_flops_per_cycle = 2 * 2;
+    return pi_block_scalar;
+}
+
+// TSC yok; frekans bilinmediği için tepe değer hesaplanmaz.
+static double tsc_ghz(void) { return 0.0; }
+#endif
+
+void pi_simd() {
+    double pi = 0.0;
+    step = 1.0 / (double)num_steps;
+
+    const char* isa;
+    int flops_per_cycle;
+    pi_kernel_fn kernel = select_pi_kernel(&isa, &flops_per_cycle);
+    double ghz = tsc_ghz();
+
+    omp_set_num_threads(NUM_THREADS);
+    int nthreads = 1;
+    double t0 = omp_get_wtime();
+
+    #pragma omp parallel reduction(+:pi)
+    {
+        int id     = omp_get_thread_num();
+        int nthrds = omp_get_num_threads();
+        if (id == 0) nthreads = nthrds;
+
+        // Bitişik blok: thread id'ye göre [begin, end)
+        long begin = num_steps * id / nthrds;
+        long end   = num_steps * (id + 1) / nthrds;
+        pi += kernel(begin, end, step);
+    }
+    pi *= step;
+
+    double t1 = omp_get_wtime();
+    double gflops = (double)FLOPS_PER_STEP * num_steps / (t1 - t0) / 1e9;
+    // Thread sayısı çekirdek sayısını geçerse tepe değer artmaz.
+    int cores = nthreads < omp_get_num_procs() ? nthreads : omp_get_num_procs();
+    double peak = cores * ghz * flops_per_cycle;
+    printf("[5] Blocked SIMD    : pi = %.10f | time = %.4f s\n", pi, t1 - t0);
+    if (ghz > 0)
+        printf("    kernel = %s, %.2f GFLOP/s of %.1f GFLOP/s FMA peak (%.1f%%, %d cores @ %.2f GHz TSC)\n",
+               isa, gflops, peak, 100.0 * gflops / peak, cores, ghz);
+    else
+        printf("    kernel = %s, %.2f GFLOP/s (%d cores)\n", isa, gflops, cores);
+    printf("    (div is not pipelined like FMA, so this kernel is bounded by divider throughput)\n");
+}
+
+// 6) Monte Carlo
+// Birim karenin içine rastgele noktalar atılır; çeyrek dairenin içine düşen
+// oran pi/4'e yakınsar. Hata 1/sqrt(N) ile azaldığı için integralden çok
+// daha yavaş yakınsar ama risk simülasyonları gibi rastgele sayı ağırlıklı
+// işlerin tipik örneğidir ve yükün neredeyse tamamı RNG'dedir.
+//
+// rand() paylaşılan tek bir state tutar ve glibc bu state'i bir lock ile
+// korur: bütün thread'ler aynı lock'u ve aynı cache line'ı paylaşır.
+// Burada bunun yerine counter-based bir üreteç (Philox4x32-10) kullanılıyor:
+//   sayı = philox(counter, key)
+// State yoktur; i. sayı doğrudan i'den hesaplanır. Her thread sayaç uzayının
+// kendine ait bir aralığını kullanır, paylaşılan hiçbir şey yazılmaz ve
+// sonuç thread sayısından bağımsız olarak aynı çıkar (tekrar üretilebilir).
+// Ayrı bir akış (stream) gerekiyorsa key[1] olarak akış numarası verilir.
+// Sayaçlar birbirinden bağımsız olduğu için MC_LANES sayaç aynı anda
+// vektör register'larında hesaplanır.
+
+#define PHILOX_M0 0xD2511F53u
+#define PHILOX_M1 0xCD9E8D57u
+#define PHILOX_W0 0x9E3779B9u
+#define PHILOX_W1 0xBB67AE85u
+#define MC_LANES 16
+#define MC_SEED 2024u
+
+// c[0..3][l] → l. şeridin 128 bitlik sayacı, yerinde rastgele çıktıya dönüşür.
+static inline void philox4x32_10(uint32_t c[4][MC_LANES], uint32_t k0, uint32_t k1) {
+    for (int r = 0; r < 10; r++) {
+        #pragma omp simd
+        for (int l = 0; l < MC_LANES; l++) {
+            uint64_t p0 = (uint64_t)PHILOX_M0 * c[0][l];
+            uint64_t p1 = (uint64_t)PHILOX_M1 * c[2][l];
+            uint32_t n0 = (uint32_t)(p1 >> 32) ^ c[1][l] ^ k0;
+            uint32_t n2 = (uint32_t)(p0 >> 32) ^ c[3][l] ^ k1;
+            c[0][l] = n0;
+            c[1][l] = (uint32_t)p1;
+            c[2][l] = n2;
+            c[3][l] = (uint32_t)p0;
+        }
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+}
+
+// Random123'teki bilinen cevap (known-answer) vektörleriyle kontrol.
+static int philox_self_test(void) {
+    uint32_t c[4][MC_LANES] = {{0}};
+    for (int w = 0; w < 4; w++) c[w][1] = 0xffffffffu;
+    philox4x32_10(c, 0, 0);
+    int ok = c[0][0] == 0x6627e8d5u && c[1][0] == 0xe169c58du &&
+             c[2][0] == 0xbc57ac4cu && c[3][0] == 0x9b00dbd8u;
+    uint32_t d[4][MC_LANES] = {{0}};
+    for (int w = 0; w < 4; w++) d[w][0] = 0xffffffffu;
+    philox4x32_10(d, 0xffffffffu, 0xffffffffu);
+    ok = ok && d[0][0] == 0x408f276du && d[1][0] == 0x41c83b0eu &&
+         d[2][0] == 0xa20bc7c6u && d[3][0] == 0x6d5451fdu;
+    return ok;
+}
+
+// [begin, end) batch'lerindeki noktalardan kaçının çeyrek daireye düştüğü.
+// Her batch MC_LANES sayaç = MC_LANES * 2 nokta (her çıktı 4 x 32 bit → 2 nokta).
+// target_clones: derleyici AVX-512, AVX2 ve varsayılan sürümleri üretir,
+// hangisinin çağrılacağı program yüklenirken CPU'ya göre seçilir (sadece x86).
+#ifdef PI_X86
+__attribute__((target_clones("avx512f", "avx2", "default")))
+#endif
+static long long mc_block(long long begin, long long end) {
+    const double scale = 1.0 / 4294967296.0;   // 2^-32
+    long long hits = 0;
+    for (long long b = begin; b < end; b++) {
+        uint32_t c[4][MC_LANES];
+        for (int l = 0; l < MC_LANES; l++) {
+            uint64_t ctr = (uint64_t)b * MC_LANES + l;
+            c[0][l] = (uint32_t)ctr;
+            c[1][l] = (uint32_t)(ctr >> 32);
+            c[2][l] = 0;
+            c[3][l] = 0;
+        }
+        philox4x32_10(c, MC_SEED, 0);
+
+        int batch_hits = 0;
+        #pragma omp simd reduction(+:batch_hits)
+        for (int l = 0; l < MC_LANES; l++) {
+            double x0 = c[0][l] * scale, y0 = c[1][l] * scale;
+            double x1 = c[2][l] * scale, y1 = c[3][l] * scale;
+            batch_hits += (x0 * x0 + y0 * y0 < 1.0) + (x1 * x1 + y1 * y1 < 1.0);
+        }
+        hits += batch_hits;
+    }
+    return hits;
+}
+
+static double mc_philox(long long samples, int threads, double* seconds) {
+    long long batches = samples / (2 * MC_LANES);
+    long long hits = 0;
+    double t0 = omp_get_wtime();
+
+    #pragma omp parallel num_threads(threads) reduction(+:hits)
+    {
+        int id     = omp_get_thread_num();
+        int nthrds = omp_get_num_threads();
+        // Her thread sayaç uzayının bitişik bir parçasını alır.
+        long long begin = batches * id / nthrds;
+        long long end   = batches * (id + 1) / nthrds;
+        hits += mc_block(begin, end);
+    }
+
+    *seconds = omp_get_wtime() - t0;
+    return 4.0 * (double)hits / (double)(batches * 2 * MC_LANES);
+}
+
+// rand(): her çağrı glibc'nin içindeki lock'u alıp bırakır.
+static double mc_rand(long long samples, int threads, double* seconds) {
+    long long hits = 0;
+    double t0 = omp_get_wtime();
+
+    #pragma omp parallel for num_threads(threads) reduction(+:hits)
+    for (long long i = 0; i < samples; i++) {
+        double x = rand() / ((double)RAND_MAX + 1.0);
+        double y = rand() / ((double)RAND_MAX + 1.0);
+        hits += x * x + y * y < 1.0;
+    }
+
+    *seconds = omp_get_wtime() - t0;
+    return 4.0 * (double)hits / (double)samples;
+}
+
+// rand_r(): state thread'e özel, lock yok; ama hâlâ skaler ve zayıf bir üreteç.
+static double mc_rand_r(long long samples, int threads, double* seconds) {
+    long long hits = 0;
+    double t0 = omp_get_wtime();
+
+    #pragma omp parallel num_threads(threads) reduction(+:hits)
+    {
+        unsigned int state = MC_SEED + omp_get_thread_num();
+        #pragma omp for
+        for (long long i = 0; i < samples; i++) {
+            double x = rand_r(&state) / ((double)RAND_MAX + 1.0);
+            double y = rand_r(&state) / ((double)RAND_MAX + 1.0);
+            hits += x * x + y * y < 1.0;
+        }
+    }
+
+    *seconds = omp_get_wtime() - t0;
+    return 4.0 * (double)hits / (double)samples;
+}
+
+void pi_monte_carlo() {
+    const long long samples = 1LL << 26;
+    double t;
+
+    printf("[6] Monte Carlo     : Philox4x32-10 self test %s\n", philox_self_test() ? "passed" : "FAILED");
+
+    printf("    %-26s %7s %14s %12s %10s\n", "generator", "threads", "pi", "time", "Msamples/s");
+    double pi = mc_rand(samples / 8, NUM_THREADS, &t);
+    printf("    %-26s %7d %14.10f %10.4f s %10.1f\n", "rand() (global lock)", NUM_THREADS, pi, t, samples / 8 / t / 1e6);
+    pi = mc_rand(samples / 8, 1, &t);
+    printf("    %-26s %7d %14.10f %10.4f s %10.1f\n", "rand() (global lock)", 1, pi, t, samples / 8 / t / 1e6);
+    pi = mc_rand_r(samples, NUM_THREADS, &t);
+    printf("    %-26s %7d %14.10f %10.4f s %10.1f\n", "rand_r() (per-thread)", NUM_THREADS, pi, t, samples / t / 1e6);
+    pi = mc_philox(samples, NUM_THREADS, &t);
+    printf("    %-26s %7d %14.10f %10.4f s %10.1f\n", "Philox (counter, SIMD)", NUM_THREADS, pi, t, samples / t / 1e6);
+
+    // Yakınsama: her thread aynı sayıda nokta üretir, yani aynı süre içinde
+    // toplam nokta sayısı thread sayısıyla artar ve standart hata
+    // sqrt(pi * (4 - pi) / N) ile düşer. Aynı N için sonuç thread sayısından
+    // bağımsızdır (sayaç uzayı aynı, sadece bölüşüm farklı).
+    printf("    convergence (2^24 samples per thread):\n");
+    printf("    %7s %14s %14s %10s %10s %10s\n", "threads", "samples", "pi", "|error|", "std.err", "time");
+    for (int th = 1; th <= 2 * NUM_THREADS; th *= 2) {
+        long long n = (1LL << 24) * th;
+        pi = mc_philox(n, th, &t);
+        printf("    %7d %14lld %14.10f %10.2e %10.2e %8.4f s\n",
+               th, n, pi, fabs(pi - M_PI), sqrt(M_PI * (4.0 - M_PI) / n), t);
+    }
+    double a, b;
+    double pa = mc_philox(samples, 1, &a), pb = mc_philox(samples, NUM_THREADS, &b);
+    printf("    same %lld samples on 1 and %d threads: %s\n", samples, NUM_THREADS,
+           pa == pb ? "identical" : "DIFFERENT");
+}
+
 int main() {
-    printf("Comparing 4 Pi implementations (NUM_THREADS=%d)\n", NUM_THREADS);
+    printf("Comparing 6 Pi implementations (NUM_THREADS=%d)\n", NUM_THREADS);
     printf("------------------------------------------------\n");
     pi_false_sharing();
     pi_padded();
     pi_critical();
     pi_atomic();
+    pi_simd();
+    pi_monte_carlo();
     return 0;
 }
 
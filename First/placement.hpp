@@ -0,0 +1,120 @@
+#pragma once
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/*
+ * thread_placement
+ * Bir benchmark sonucuna güvenmeden önce thread'lerin gerçekten nerede
+ * çalıştığını bilmek gerekir: iki thread aynı çekirdeğin hyper-thread
+ * kardeşlerinde mi, farklı soketlerde mi, yoksa OS onları sürekli
+ * taşıyor mu (affinity mask'ı geniş)?
+ *
+ * current_placement() çağıran thread için şunları toplar:
+ *   tid       → işletim sisteminin thread id'si (gettid)
+ *   cpu       → şu an üzerinde çalıştığı mantıksal CPU (sched_getcpu)
+ *   node      → bu CPU'nun NUMA node'u (getcpu)
+ *   core      → /sys/.../topology/core_id
+ *   socket    → /sys/.../topology/physical_package_id
+ *   siblings  → aynı fiziksel çekirdeği paylaşan CPU'lar (SMT kardeşleri)
+ *   affinity  → thread'in çalışmasına izin verilen CPU'lar; tek CPU ise
+ *               thread bağlı (bound), genişse OS her an taşıyabilir
+ *
+ * Windows'ta sadece tid ve cpu doldurulur.
+ */
+struct thread_placement {
+    long tid = -1;
+    int cpu = -1;
+    int node = -1;
+    int core = -1;
+    int socket = -1;
+    std::string siblings;
+    std::string affinity;
+    int affinity_count = 0;   // affinity mask'taki CPU sayısı
+};
+
+inline std::string read_sys_line(const std::string& path) {
+    std::ifstream in(path);
+    std::string line;
+    std::getline(in, line);
+    return line;
+}
+
+inline long current_tid() {
+#ifdef _WIN32
+    return static_cast<long>(GetCurrentThreadId());
+#else
+    // glibc'nin gettid() sarmalayıcısı 2.30'da geldi, syscall her yerde çalışır.
+    return static_cast<long>(syscall(SYS_gettid));
+#endif
+}
+
+#ifndef _WIN32
+// {0,1,2,3,8} → "0-3,8"
+inline std::string cpu_set_to_string(const cpu_set_t& set, int* count) {
+    std::string out;
+    *count = 0;
+    for (int c = 0; c < CPU_SETSIZE; c++) {
+        if (!CPU_ISSET(c, &set)) continue;
+        int end = c;
+        while (end + 1 < CPU_SETSIZE && CPU_ISSET(end + 1, &set)) end++;
+        if (!out.empty()) out += ",";
+        out += end == c ? std::to_string(c) : std::to_string(c) + "-" + std::to_string(end);
+        *count += end - c + 1;
+        c = end;
+    }
+    return out;
+}
+#endif
+
+inline thread_placement current_placement() {
+    thread_placement p;
+    p.tid = current_tid();
+#ifdef _WIN32
+    p.cpu = static_cast<int>(GetCurrentProcessorNumber());
+#else
+    unsigned cpu = 0, node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+        p.cpu = static_cast<int>(cpu);
+        p.node = static_cast<int>(node);
+    } else {
+        p.cpu = sched_getcpu();
+    }
+
+    const std::string topo = "/sys/devices/system/cpu/cpu" + std::to_string(p.cpu) + "/topology/";
+    std::string core = read_sys_line(topo + "core_id");
+    std::string socket = read_sys_line(topo + "physical_package_id");
+    p.core = core.empty() ? -1 : std::stoi(core);
+    p.socket = socket.empty() ? -1 : std::stoi(socket);
+    p.siblings = read_sys_line(topo + "thread_siblings_list");
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        p.affinity = cpu_set_to_string(set, &p.affinity_count);
+    }
+#endif
+    return p;
+}
+
+inline void print_placement_header() {
+    std::printf("%-10s %8s %5s %5s %5s %7s %-10s %s\n",
+                "thread", "tid", "cpu", "node", "core", "socket", "smt", "affinity");
+}
+
+inline void print_placement(const char* label, int id, const thread_placement& p) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%s %d", label, id);
+    std::printf("%-10s %8ld %5d %5d %5d %7d %-10s %s%s\n",
+                name, p.tid, p.cpu, p.node, p.core, p.socket,
+                p.siblings.c_str(), p.affinity.c_str(),
+                p.affinity_count == 1 ? " (bound)" : "");
+}
@@ -0,0 +1,149 @@
+#include <omp.h>
+#include <iostream>
+#include <vector>
+#include <set>
+#include <future>
+#include <thread>
+#include <cstdlib>
+
+#include "placement.hpp"
+#include "../RAII/worker_pool.hpp"
+
+using namespace std;
+
+// Her OpenMP ve WorkerPool thread'i için nerede çalıştığını yazdırır ve
+// OMP_PROC_BIND / OMP_PLACES ayarlarının gerçekten etki edip etmediğini
+// kontrol eder. Benchmark sonuçlarına bakmadan önce çalıştırın:
+//
+//   ./placement_report                               → bağlama yok
+//   OMP_PROC_BIND=close OMP_PLACES=cores ./placement_report
+//   OMP_PROC_BIND=spread OMP_PLACES=threads ./placement_report
+//
+// Migration kontrolü: her thread ~50 ms boyunca meşgul bekler ve
+// sched_getcpu() değerini örnekler; CPU değiştiyse thread taşınmıştır.
+//
+// g++ -std=c++20 -O2 -fopenmp -pthread placement_report.cpp -o placement_report
+// ./placement_report [threads]
+
+const char* proc_bind_name(omp_proc_bind_t b) {
+    switch (b) {
+        case omp_proc_bind_false:  return "false";
+        case omp_proc_bind_true:   return "true";
+        case omp_proc_bind_master: return "primary";
+        case omp_proc_bind_close:  return "close";
+        case omp_proc_bind_spread: return "spread";
+        default:                   return "?";
+    }
+}
+
+// Thread'i ~50 ms meşgul eder, kaç farklı CPU'da görüldüğünü döndürür.
+int cpus_seen_while_spinning() {
+    set<int> seen;
+    double t0 = omp_get_wtime();
+    while (omp_get_wtime() - t0 < 0.05) {
+        seen.insert(sched_getcpu());
+    }
+    return seen.size();
+}
+
+struct Observed {
+    thread_placement p;
+    int place = -1;
+    int cpus_seen = 0;
+};
+
+void summarize(const vector<Observed>& threads) {
+    int bound = 0, migrated = 0;
+    set<int> cpus, sockets;
+    set<pair<int, int>> cores;
+    for (const Observed& o : threads) {
+        bound += o.p.affinity_count == 1;
+        migrated += o.cpus_seen > 1;
+        cpus.insert(o.p.cpu);
+        sockets.insert(o.p.socket);
+        cores.insert({o.p.socket, o.p.core});
+    }
+    const int n = threads.size();
+    printf("  bound to a single CPU : %d / %d\n", bound, n);
+    printf("  migrated while running: %d / %d\n", migrated, n);
+    printf("  distinct CPUs / cores / sockets: %zu / %zu / %zu\n", cpus.size(), cores.size(), sockets.size());
+    if ((int)cpus.size() < n) {
+        printf("  WARNING: %d threads share CPUs (oversubscribed or bound to the same place)\n",
+               n - (int)cpus.size());
+    } else if (cores.size() < cpus.size()) {
+        printf("  note: some threads are SMT siblings on the same core\n");
+    }
+    if (bound < n) {
+        printf("  threads are not pinned; results may move between runs\n");
+    }
+}
+
+int main(int argc, char** argv) {
+    int threads = argc > 1 ? atoi(argv[1]) : omp_get_max_threads();
+
+    const char* bind_env = getenv("OMP_PROC_BIND");
+    const char* places_env = getenv("OMP_PLACES");
+    printf("OMP_PROC_BIND = %s, OMP_PLACES = %s\n", bind_env ? bind_env : "(unset)", places_env ? places_env : "(unset)");
+    printf("omp_get_proc_bind() = %s, %d places\n", proc_bind_name(omp_get_proc_bind()), omp_get_num_places());
+    for (int pl = 0; pl < omp_get_num_places(); pl++) {
+        vector<int> ids(omp_get_place_num_procs(pl));
+        omp_get_place_proc_ids(pl, ids.data());
+        printf("  place %d: {", pl);
+        for (size_t k = 0; k < ids.size(); k++) printf(k ? ",%d" : "%d", ids[k]);
+        printf("}\n");
+    }
+
+    // ---- OpenMP thread'leri ----
+    vector<Observed> omp_threads(threads);
+    #pragma omp parallel num_threads(threads)
+    {
+        int id = omp_get_thread_num();
+        omp_threads[id].cpus_seen = cpus_seen_while_spinning();
+        omp_threads[id].p = current_placement();
+        omp_threads[id].place = omp_get_place_num();
+    }
+
+    printf("\n--- OpenMP threads ---\n");
+    print_placement_header();
+    for (int i = 0; i < threads; i++) {
+        print_placement("omp", i, omp_threads[i].p);
+    }
+    for (int i = 0; i < threads; i++) {
+        if (omp_threads[i].place >= 0) {
+            printf("  omp %d -> place %d\n", i, omp_threads[i].place);
+        }
+    }
+    summarize(omp_threads);
+    // Bağlama etkinse her thread'in affinity mask'ı kendi place'i kadar olmalı.
+    if (omp_get_proc_bind() != omp_proc_bind_false) {
+        int matching = 0;
+        for (const Observed& o : omp_threads) {
+            matching += o.place >= 0 && o.p.affinity_count == omp_get_place_num_procs(o.place);
+        }
+        printf("  affinity mask == assigned place: %d / %d%s\n", matching, threads,
+               matching == threads ? " (binding is in effect)" : " (binding NOT in effect)");
+    } else if (bind_env || places_env) {
+        printf("  OMP_PROC_BIND/OMP_PLACES set but binding is off (check the values)\n");
+    }
+
+    // ---- WorkerPool thread'leri ----
+    // Pool kendi thread'lerini bağlamaz; burada OS'nin verdiği yer görünür.
+    printf("\n--- WorkerPool threads ---\n");
+    WorkerPool pool(threads);
+    vector<future<Observed>> fs;
+    for (int i = 0; i < threads; i++) {
+        fs.push_back(pool.submit_to(i, [] {
+            Observed o;
+            o.cpus_seen = cpus_seen_while_spinning();
+            o.p = current_placement();
+            return o;
+        }));
+    }
+    vector<Observed> pool_threads;
+    for (auto& f : fs) pool_threads.push_back(f.get());
+    print_placement_header();
+    for (int i = 0; i < threads; i++) {
+        print_placement("pool", i, pool_threads[i].p);
+    }
+    summarize(pool_threads);
+}
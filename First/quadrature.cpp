@@ -0,0 +1,128 @@
+#include <omp.h>
+#include <iostream>
+#include <cmath>
+#include <thread>
+#include <vector>
+#include <cstdio>
+
+#include "quadrature.hpp"
+
+using namespace std;
+
+// Adaptif Gauss–Kronrod (quadrature.hpp) ile pi_comparison.c'deki sabit
+// adımlı midpoint yaklaşımını aynı hedef doğrulukta karşılaştırıyoruz.
+//
+//   1) Her integrand için tol = 1e-10:
+//        adaptive → kaç f değerlendirmesi, ne kadar süre, gerçek hata
+//        midpoint → num_steps 2 katına çıkarılarak aynı hataya inene kadar
+//                   (pi_comparison.c'deki gibi parallel for + reduction)
+//   2) Pahalı bir integrandla WorkerPool thread sayısına göre ölçekleme.
+//
+// g++ -std=c++20 -O2 -march=native -fopenmp -pthread quadrature.cpp -o quadrature
+// ./quadrature [max_threads]
+
+const double TOL = 1e-10;
+const long MAX_STEPS = 1L << 28;
+
+// Midpoint kuralını num_steps'i ikiye katlayarak tol'a inene kadar çalıştırır.
+// Her denemenin değerlendirmesi toplam maliyete eklenir (adaptif tarafta da
+// bölünüp tekrar hesaplanan aralıklar sayıldığı için adil olsun).
+template <typename F>
+void midpoint_until(const F& f, double a, double b, double exact, long& evals, double& value) {
+    evals = 0;
+    for (long n = 1024; n <= MAX_STEPS; n *= 2) {
+        double step = (b - a) / n;
+        double sum = 0.0;
+        #pragma omp parallel for reduction(+:sum)
+        for (long i = 0; i < n; i++) {
+            sum += f(a + (i + 0.5) * step);
+        }
+        value = sum * step;
+        evals += n;
+        if (fabs(value - exact) <= TOL) {
+            return;
+        }
+    }
+}
+
+template <typename F>
+void compare(WorkerPool& pool, const char* name, const F& f, double a, double b, double exact) {
+    double t0 = omp_get_wtime();
+    quad_result r = integrate(pool, f, a, b, TOL);
+    double t_adaptive = omp_get_wtime() - t0;
+
+    long mid_evals;
+    double mid_value;
+    t0 = omp_get_wtime();
+    midpoint_until(f, a, b, exact, mid_evals, mid_value);
+    double t_mid = omp_get_wtime() - t0;
+
+    bool mid_ok = fabs(mid_value - exact) <= TOL;
+    printf("%-12s | %10ld %6ld %9.3f ms %9.1e | %11ld%s %9.3f ms %9.1e | %7.0fx\n",
+           name, r.evaluations, r.intervals, t_adaptive * 1e3, fabs(r.value - exact),
+           mid_evals, mid_ok ? " " : "*", t_mid * 1e3, fabs(mid_value - exact),
+           (double)mid_evals / r.evaluations);
+}
+
+// Her noktada 200 terimlik bir seri: tek değerlendirme birkaç mikro saniye,
+// böylece ölçeklemede zamanlama maliyeti değil hesap baskın olur.
+static double expensive(double x) {
+    double s = 0.0;
+    for (int k = 1; k <= 200; k++) {
+        s += sin(k * x) / (k * k);
+    }
+    return s;
+}
+
+int main(int argc, char** argv) {
+    int max_threads = argc > 1 ? atoi(argv[1]) : (int)max(1u, thread::hardware_concurrency());
+    if (max_threads < 1) {
+        fprintf(stderr, "usage: %s [max_threads >= 1]\n", argv[0]);
+        return 1;
+    }
+    omp_set_num_threads(max_threads);
+    WorkerPool pool(max_threads);
+
+    printf("tol = %.0e, %d threads\n\n", TOL, max_threads);
+    printf("%-12s | %-40s | %-38s | %s\n", "integrand", "adaptive Gauss-Kronrod (G7/K15)",
+           "fixed-step midpoint", "evals");
+    printf("%-12s | %10s %6s %12s %9s | %12s %12s %9s | %s\n", "", "evals", "intvl", "time",
+           "|err|", "evals", "time", "|err|", "ratio");
+    printf("-------------------------------------------------------------------------------------------------------------\n");
+
+    // pi_comparison.c'deki integral
+    compare(pool, "4/(1+x^2)", [](double x) { return 4.0 / (1.0 + x * x); }, 0.0, 1.0, M_PI);
+    // Düzgün ama geniş aralık
+    compare(pool, "exp(-x^2)", [](double x) { return exp(-x * x); }, -5.0, 5.0, sqrt(M_PI) * erf(5.0));
+    // Salınımlı
+    compare(pool, "cos(100x)", [](double x) { return cos(100.0 * x); }, 0.0, 1.0, sin(100.0) / 100.0);
+    // x = 0.3'te dar bir tepe: sabit adım her yerde tepe kadar sık örnekler
+    const double eps = 1e-3;
+    compare(pool, "peak 0.3", [=](double x) { return 1.0 / (eps * eps + (x - 0.3) * (x - 0.3)); },
+            0.0, 1.0, (atan(0.7 / eps) + atan(0.3 / eps)) / eps);
+    // Uçta türevi sonsuz: midpoint yavaş yakınsar
+    compare(pool, "sqrt(x)", [](double x) { return sqrt(x); }, 0.0, 1.0, 2.0 / 3.0);
+    printf("(* = midpoint did not reach tol within %ld steps)\n", MAX_STEPS);
+
+    // Ölçekleme: aynı integral 1, 2, 4 ... thread'li havuzlarla.
+    printf("\n--- scaling, expensive integrand on [0, 20], tol 1e-12 ---\n");
+    printf("%4s %12s %10s %8s %10s\n", "thr", "time", "intervals", "speedup", "eff%");
+    double base = 0;
+    vector<int> thread_counts;
+    for (int t = 1; t <= max_threads; t *= 2) thread_counts.push_back(t);
+    if (thread_counts.back() != max_threads) thread_counts.push_back(max_threads);
+
+    for (int t : thread_counts) {
+        WorkerPool p(t);
+        integrate(p, expensive, 0.0, 20.0, 1e-12);   // ısınma
+        double t0 = omp_get_wtime();
+        quad_result r = integrate(p, expensive, 0.0, 20.0, 1e-12);
+        double dt = omp_get_wtime() - t0;
+        if (t == 1) base = dt;
+        printf("%4d %9.3f ms %10ld %7.2fx %9.0f%%   value = %.15f\n",
+               t, dt * 1e3, r.intervals, base / dt, base / dt / t * 100.0, r.value);
+    }
+
+    printf("\nintegrate(f, a, b, tol) with the default pool: %.15f\n",
+           integrate([](double x) { return 4.0 / (1.0 + x * x); }, 0.0, 1.0, 1e-12));
+}
@@ -0,0 +1,243 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+#include "../RAII/worker_pool.hpp"
+#include "per_thread.hpp"
+
+/*
+ * integrate(f, a, b, tol)
+ * pi_comparison.c tek bir integrali (4 / (1 + x^2)) sabit num_steps ile
+ * midpoint kuralıyla hesaplıyor. Integrand nerede düzgün nerede dik olursa
+ * olsun her yere aynı sıklıkta nokta koyuyor ve hedef doğruluğa ulaşmak için
+ * çok fazla değerlendirme (evaluation) yapıyor.
+ *
+ * Burada adaptif Gauss–Kronrod (G7/K15) kullanılır:
+ *   - Her aralıkta 15 Kronrod noktası hesaplanır. Aynı noktaların 7 tanesi
+ *     Gauss kuralını da verir, |K15 - G7| farkından hata tahmini çıkar
+ *     (QUADPACK qk15 ile aynı ölçekleme).
+ *   - Tahmini hata aralığın payına düşen toleransı (tol * genişlik / (b - a))
+ *     aşıyorsa aralık ikiye bölünür. Düzgün bölgeler birkaç aralıkta biter,
+ *     noktalar sadece gereken yerlerde sıklaşır.
+ *   - Aralıklar WorkerPool üzerinde iş (task) olarak dağıtılır. Her iş kendi
+ *     yerel yığınından (stack) derinlik öncelikli ilerler ve QUAD_GRAIN aralık
+ *     işledikçe yığının en geniş (en eski) aralığını havuza bırakır. Boştaki
+ *     worker'lar bu işleri çalar (work stealing); iş sayısı toplam işle
+ *     orantılı kalır ve derin bir tepe noktası tek worker'a sıkışmaz.
+ *   - 15 nokta (+1 dolgu) tek bir "omp simd" döngüsünde hesaplanır.
+ *     f inline edilebilen bir lambda ise derleyici değerlendirmeyi
+ *     vektörleştirir (AVX2 ile 4, AVX-512 ile 8 nokta aynı anda).
+ *     Dolgu noktası da f'i çağırdığı için evaluations aralık başına 16 sayar.
+ *
+ * tol mutlak hata hedefidir. Bir aralık max_depth kez bölünmesine rağmen
+ * yakınsamazsa kabul edilir ve sonuçta converged = false döner.
+ *
+ * Havuzun bir worker'ı içinden çağrılırsa integral aynı thread'de seri olarak
+ * hesaplanır: worker'ın future beklemesi havuzu kilitleyebilirdi.
+ */
+
+constexpr int GK_NODES = 16;         // 15 Kronrod noktası + 1 dolgu
+constexpr long QUAD_GRAIN = 32;      // bir iş kaç aralıkta bir havuza iş bırakır
+
+// [-1, 1] üzerindeki konumlar: -x0..-x6, 0, +x6..+x0, dolgu (0).
+alignas(64) inline constexpr double gk_offsets[GK_NODES] = {
+    -0.991455371120812639206854697526329, -0.949107912342758524526189684047851,
+    -0.864864423359769072789712788640926, -0.741531185599394439863864773280788,
+    -0.586087235467691130294144845693013, -0.405845151377397166906606412076961,
+    -0.207784955007898467600689403773245,  0.0,
+     0.207784955007898467600689403773245,  0.405845151377397166906606412076961,
+     0.586087235467691130294144845693013,  0.741531185599394439863864773280788,
+     0.864864423359769072789712788640926,  0.949107912342758524526189684047851,
+     0.991455371120812639206854697526329,  0.0};
+
+alignas(64) inline constexpr double gk_kronrod[GK_NODES] = {
+    0.022935322010529224963732008058970, 0.063092092629978553290700663189204,
+    0.104790010322250183839876322541518, 0.140653259715525918745189590510238,
+    0.169004726639267902826583426598550, 0.190350578064785409913256402421014,
+    0.204432940075298892414161999234649, 0.209482141084727828012999174891714,
+    0.204432940075298892414161999234649, 0.190350578064785409913256402421014,
+    0.169004726639267902826583426598550, 0.140653259715525918745189590510238,
+    0.104790010322250183839876322541518, 0.063092092629978553290700663189204,
+    0.022935322010529224963732008058970, 0.0};
+
+// Gauss ağırlıkları sadece tek indisli Kronrod noktalarında sıfırdan farklı.
+alignas(64) inline constexpr double gk_gauss[GK_NODES] = {
+    0.0, 0.129484966168869693270611432679082,
+    0.0, 0.279705391489276667901467771423780,
+    0.0, 0.381830050505118944950369775488975,
+    0.0, 0.417959183673469387755102040816327,
+    0.0, 0.381830050505118944950369775488975,
+    0.0, 0.279705391489276667901467771423780,
+    0.0, 0.129484966168869693270611432679082,
+    0.0, 0.0};
+
+struct gk_estimate {
+    double value;
+    double error;
+};
+
+// Tek bir aralıkta K15 değeri ve hata tahmini.
+template <typename F>
+inline gk_estimate gk15(const F& f, double lo, double hi) {
+    const double center = 0.5 * (lo + hi);
+    const double half = 0.5 * (hi - lo);
+
+    alignas(64) double fx[GK_NODES];
+    #pragma omp simd aligned(fx : 64)
+    for (int i = 0; i < GK_NODES; i++) {
+        fx[i] = f(center + half * gk_offsets[i]);
+    }
+
+    double k = 0.0, g = 0.0;
+    for (int i = 0; i < GK_NODES; i++) {
+        k += gk_kronrod[i] * fx[i];
+        g += gk_gauss[i] * fx[i];
+    }
+    // resasc: integrandın ortalamadan sapması, hata tahmininin ölçeği.
+    const double mean = 0.5 * k;
+    double asc = 0.0;
+    for (int i = 0; i < GK_NODES; i++) {
+        asc += gk_kronrod[i] * std::fabs(fx[i] - mean);
+    }
+
+    double err = std::fabs((k - g) * half);
+    asc *= std::fabs(half);
+    if (asc != 0.0 && err != 0.0) {
+        err = asc * std::min(1.0, std::pow(200.0 * err / asc, 1.5));
+    }
+    return {k * half, err};
+}
+
+struct quad_result {
+    double value;
+    double error;         // kabul edilen aralıkların tahmini hatalarının toplamı
+    long evaluations;     // f çağrı sayısı
+    long intervals;       // kabul edilen aralık sayısı
+    bool converged;       // false: max_depth'e takılan aralık var
+};
+
+template <typename F>
+class quad_engine {
+public:
+    quad_engine(WorkerPool* pool, const F& f, double a, double b, double tol, int max_depth)
+        : pool_(pool), f_(f), a_(a), b_(b), tol_(tol), max_depth_(max_depth),
+          partial_(pool != nullptr ? pool->size() : 1, quad_result{0.0, 0.0, 0, 0, true}) {}
+
+    quad_result run() {
+        if (pool_ == nullptr) {
+            process({a_, b_, 0}, 0);
+        } else {
+            spawn({a_, b_, 0});
+            std::unique_lock<std::mutex> lock(done_mtx_);
+            done_cv_.wait(lock, [this] { return done_; });
+        }
+        return partial_.combine([](quad_result acc, const quad_result& p) {
+            return quad_result{acc.value + p.value, acc.error + p.error,
+                               acc.evaluations + p.evaluations, acc.intervals + p.intervals,
+                               acc.converged && p.converged};
+        }, quad_result{0.0, 0.0, 0, 0, true});
+    }
+
+private:
+    struct interval {
+        double lo, hi;
+        int depth;
+    };
+
+    void spawn(interval iv) {
+        pending_.fetch_add(1, std::memory_order_relaxed);
+        pool_->submit([this, iv] {
+            process(iv, static_cast<std::size_t>(pool_->current_worker()));
+            // Son biten iş bekleyen çağıranı uyandırır. notify lock altında
+            // yapılır, yoksa çağıran dönüp engine'i yok edebilirdi.
+            if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                std::lock_guard<std::mutex> lock(done_mtx_);
+                done_ = true;
+                done_cv_.notify_one();
+            }
+        });
+    }
+
+    // Aralıkları yerel bir yığında işler; slot'a sadece bu worker yazar.
+    void process(interval first, std::size_t slot) {
+        quad_result& acc = partial_[slot];
+        std::deque<interval> stack{first};
+        long since_spawn = 0;
+
+        while (!stack.empty()) {
+            interval iv = stack.back();
+            stack.pop_back();
+
+            gk_estimate e = gk15(f_, iv.lo, iv.hi);
+            acc.evaluations += GK_NODES;   // dolgu noktası da f'i çağırır
+            const double allowed = tol_ * std::fabs((iv.hi - iv.lo) / (b_ - a_));
+
+            if (e.error <= allowed || iv.depth >= max_depth_) {
+                acc.value += e.value;
+                acc.error += e.error;
+                acc.intervals++;
+                acc.converged = acc.converged && e.error <= allowed;
+            } else {
+                const double mid = 0.5 * (iv.lo + iv.hi);
+                stack.push_back({mid, iv.hi, iv.depth + 1});
+                stack.push_back({iv.lo, mid, iv.depth + 1});
+            }
+
+            // En eski aralık yığının en genişidir: çalınmaya en değer iş.
+            if (pool_ != nullptr && ++since_spawn >= QUAD_GRAIN && stack.size() > 1) {
+                spawn(stack.front());
+                stack.pop_front();
+                since_spawn = 0;
+            }
+        }
+    }
+
+    WorkerPool* pool_;
+    const F& f_;
+    double a_, b_, tol_;
+    int max_depth_;
+    per_thread<quad_result> partial_;
+    std::atomic<long> pending_{0};
+    std::mutex done_mtx_;
+    std::condition_variable done_cv_;
+    bool done_ = false;
+};
+
+/*
+ * integrate(pool, f, a, b, tol) → ∫_a^b f(x) dx, aralıklar pool üzerinde.
+ * f aynı anda birden fazla thread'den çağrılır, yan etkisiz olmalıdır.
+ */
+template <typename F>
+quad_result integrate(WorkerPool& pool, const F& f, double a, double b, double tol,
+                      int max_depth = 50) {
+    if (a == b) {
+        return {0.0, 0.0, 0, 0, true};
+    }
+    WorkerPool* p = pool.current_worker() >= 0 ? nullptr : &pool;
+    return quad_engine<F>(p, f, a, b, tol, max_depth).run();
+}
+
+// Tek thread'de aynı algoritma (karşılaştırma ve iç içe çağrılar için).
+template <typename F>
+quad_result integrate_serial(const F& f, double a, double b, double tol, int max_depth = 50) {
+    if (a == b) {
+        return {0.0, 0.0, 0, 0, true};
+    }
+    return quad_engine<F>(nullptr, f, a, b, tol, max_depth).run();
+}
+
+// Paylaşılan varsayılan havuz, ilk kullanımda oluşturulur.
+inline WorkerPool& quad_default_pool() {
+    static WorkerPool pool;
+    return pool;
+}
+
+template <typename F>
+double integrate(const F& f, double a, double b, double tol) {
+    return integrate(quad_default_pool(), f, a, b, tol).value;
+}
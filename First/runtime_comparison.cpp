@@ -0,0 +1,247 @@
+#include <omp.h>
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <future>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+#include <numeric>
+#include <functional>
+#include <string>
+#include <cstdio>
+
+#include "../RAII/worker_pool.hpp"
+
+using namespace std;
+using namespace chrono;
+
+// Aynı kernel'leri üç farklı çalışma ortamında (runtime) koşturup
+// birebir karşılaştırıyoruz:
+//   - WorkerPool        (RAII/worker_pool.hpp, work-stealing)
+//   - OpenMP            (parallel for / task)
+//   - thread-per-task   (her iş için std::thread oluştur + join)
+//
+// Kernel'ler:
+//   pi        → pi_comparison.c'deki integral, bloklu bölünmüş
+//   sum       → 100M elemanlı dizi toplamı (bellek bant genişliği)
+//   imbalance → i arttıkça pahalılaşan döngü (dinamik dağıtım gerekir)
+//   fanout    → 10000 minik iş (iş başına zamanlama maliyeti)
+//   forkjoin  → boş paralel bölge (fork-join overhead'i)
+//
+// Her ölçüm RUNS kez tekrarlanır; medyan süre, tekrarlar arası değişkenlik
+// (CV = stddev / mean) ve aynı runtime'ın 1 thread süresine göre
+// ölçekleme verimliliği (T1 / (p * Tp)) raporlanır.
+//
+// g++ -std=c++20 -O2 -fopenmp -pthread runtime_comparison.cpp -o runtime_comparison
+// ./runtime_comparison [max_threads]
+
+const int RUNS = 7;
+const long PI_STEPS = 100000000;
+const int SUM_N = 100000000;
+const int IMB_N = 6000;
+const int FANOUT = 10000;
+const int FORKJOIN_REPS = 200;
+
+enum Runtime { POOL, OMP, THREADS, RUNTIME_COUNT };
+const char* runtime_names[RUNTIME_COUNT] = {"pool", "openmp", "thread/task"};
+
+struct Stats {
+    double median;
+    double cv;
+};
+
+Stats measure(const function<void()>& body) {
+    vector<double> t;
+    body();   // ısınma: page fault'lar, thread oluşturma vb.
+    for (int r = 0; r < RUNS; r++) {
+        double t0 = omp_get_wtime();
+        body();
+        t.push_back(omp_get_wtime() - t0);
+    }
+    double mean = accumulate(t.begin(), t.end(), 0.0) / t.size();
+    double var = 0;
+    for (double x : t) var += (x - mean) * (x - mean);
+    sort(t.begin(), t.end());
+    return {t[t.size() / 2], sqrt(var / t.size()) / mean};
+}
+
+// [0, n) aralığını parts parçaya böler ve body(begin, end) çağırır.
+// Her runtime aynı bölme mantığını kullanır, sadece dağıtma şekli değişir.
+template <typename Body>
+void run_blocks(Runtime rt, WorkerPool& pool, int threads, long n, long parts, Body body) {
+    auto bounds = [=](long k) { return make_pair(n * k / parts, n * (k + 1) / parts); };
+
+    if (rt == POOL) {
+        vector<future<void>> fs;
+        fs.reserve(parts);
+        for (long k = 0; k < parts; k++) {
+            fs.push_back(pool.submit([=] { auto [b, e] = bounds(k); body(b, e); }));
+        }
+        for (auto& f : fs) f.get();
+    } else if (rt == OMP) {
+        #pragma omp parallel for schedule(dynamic, 1) num_threads(threads)
+        for (long k = 0; k < parts; k++) {
+            auto [b, e] = bounds(k);
+            body(b, e);
+        }
+    } else {
+        // thread-per-task: threads kadar thread açılır, parçaları ortak bir
+        // sayaçtan alırlar (aksi halde dengesiz yükte haksız olurdu).
+        atomic<long> next{0};
+        vector<thread> ts;
+        for (int t = 0; t < threads; t++) {
+            ts.emplace_back([&] {
+                for (long k; (k = next.fetch_add(1)) < parts;) {
+                    auto [b, e] = bounds(k);
+                    body(b, e);
+                }
+            });
+        }
+        for (auto& t : ts) t.join();
+    }
+}
+
+double pi_kernel(Runtime rt, WorkerPool& pool, int threads) {
+    const double step = 1.0 / PI_STEPS;
+    vector<double> partial(threads * 64, 0.0);   // parça başına ayrı cache line
+    atomic<int> slot{0};
+    run_blocks(rt, pool, threads, PI_STEPS, threads, [&](long b, long e) {
+        double s = 0;
+        for (long i = b; i < e; i++) {
+            double x = (i + 0.5) * step;
+            s += 4.0 / (1.0 + x * x);
+        }
+        partial[slot.fetch_add(1) * 64] = s;
+    });
+    double pi = 0;
+    for (int t = 0; t < threads; t++) pi += partial[t * 64];
+    return pi * step;
+}
+
+long long sum_kernel(Runtime rt, WorkerPool& pool, int threads, const vector<int>& data) {
+    atomic<long long> total{0};
+    run_blocks(rt, pool, threads, data.size(), threads, [&](long b, long e) {
+        long long s = 0;
+        for (long i = b; i < e; i++) s += data[i];
+        total += s;
+    });
+    return total;
+}
+
+// i. iterasyonun maliyeti i ile doğru orantılı: son parçalar ilk parçalardan
+// çok daha pahalı, bu yüzden parça sayısı thread sayısının 16 katı.
+double imbalance_kernel(Runtime rt, WorkerPool& pool, int threads) {
+    atomic<long long> bits{0};
+    run_blocks(rt, pool, threads, IMB_N, threads * 16, [&](long b, long e) {
+        double acc = 0;
+        for (long i = b; i < e; i++) {
+            for (long k = 0; k < i; k++) acc += sin(k * 1e-3);
+        }
+        bits += (long long)acc;
+    });
+    return (double)bits;
+}
+
+void fanout_kernel(Runtime rt, WorkerPool& pool, int threads, vector<int>& out) {
+    if (rt == POOL) {
+        vector<future<void>> fs;
+        fs.reserve(FANOUT);
+        for (int i = 0; i < FANOUT; i++) fs.push_back(pool.submit([&out, i] { out[i] = i; }));
+        for (auto& f : fs) f.get();
+    } else if (rt == OMP) {
+        #pragma omp parallel num_threads(threads)
+        #pragma omp single
+        for (int i = 0; i < FANOUT; i++) {
+            #pragma omp task firstprivate(i) shared(out)
+            out[i] = i;
+        }
+    } else {
+        // Gerçek anlamda iş başına bir thread; aynı anda en fazla threads kadar.
+        for (int i = 0; i < FANOUT; i += threads) {
+            vector<thread> ts;
+            for (int k = i; k < min(FANOUT, i + threads); k++) ts.emplace_back([&out, k] { out[k] = k; });
+            for (auto& t : ts) t.join();
+        }
+    }
+}
+
+void forkjoin_kernel(Runtime rt, WorkerPool& pool, int threads) {
+    for (int r = 0; r < FORKJOIN_REPS; r++) {
+        if (rt == POOL) {
+            vector<future<void>> fs;
+            for (int t = 0; t < threads; t++) fs.push_back(pool.submit([] {}));
+            for (auto& f : fs) f.get();
+        } else if (rt == OMP) {
+            #pragma omp parallel num_threads(threads)
+            {
+                asm volatile("" ::: "memory");
+            }
+        } else {
+            vector<thread> ts;
+            for (int t = 0; t < threads; t++) ts.emplace_back([] {});
+            for (auto& t : ts) t.join();
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    int max_threads = argc > 1 ? atoi(argv[1]) : (int)max(1u, thread::hardware_concurrency());
+    if (max_threads < 1) {
+        fprintf(stderr, "usage: %s [max_threads >= 1]\n", argv[0]);
+        return 1;
+    }
+
+    vector<int> counts;
+    for (int t = 1; t < max_threads; t *= 2) counts.push_back(t);
+    counts.push_back(max_threads);
+
+    vector<int> data(SUM_N, 5);
+    vector<int> out(FANOUT);
+
+    const char* kernels[] = {"pi", "sum", "imbalance", "fanout", "forkjoin"};
+    const int KERNELS = 5;
+    // baseline[k][rt] → aynı runtime'ın 1 thread medyanı
+    double baseline[KERNELS][RUNTIME_COUNT] = {};
+
+    printf("%-10s %-12s %4s %12s %8s %8s %s\n",
+           "kernel", "runtime", "thr", "median", "cv%", "eff%", "per-unit");
+    printf("---------------------------------------------------------------------------\n");
+
+    for (int k = 0; k < KERNELS; k++) {
+        for (int threads : counts) {
+            WorkerPool pool(threads);
+            for (int rt = 0; rt < RUNTIME_COUNT; rt++) {
+                Runtime r = (Runtime)rt;
+                Stats s;
+                switch (k) {
+                    case 0: s = measure([&] { pi_kernel(r, pool, threads); }); break;
+                    case 1: s = measure([&] { sum_kernel(r, pool, threads, data); }); break;
+                    case 2: s = measure([&] { imbalance_kernel(r, pool, threads); }); break;
+                    case 3: s = measure([&] { fanout_kernel(r, pool, threads, out); }); break;
+                    default: s = measure([&] { forkjoin_kernel(r, pool, threads); }); break;
+                }
+                if (threads == 1) baseline[k][rt] = s.median;
+                double eff = baseline[k][rt] / (threads * s.median) * 100.0;
+
+                // fanout ve forkjoin için asıl ilginç olan birim maliyet
+                char unit[64] = "";
+                if (k == 3) snprintf(unit, sizeof(unit), "%.0f ns/task", s.median / FANOUT * 1e9);
+                if (k == 4) snprintf(unit, sizeof(unit), "%.2f us/fork-join", s.median / FORKJOIN_REPS * 1e6);
+
+                printf("%-10s %-12s %4d %10.4f s %7.1f%% %7.0f%% %s\n",
+                       kernels[k], runtime_names[rt], threads, s.median, s.cv * 100.0, eff, unit);
+            }
+        }
+        printf("\n");
+    }
+
+    // Doğruluk kontrolü: üç runtime da aynı sonucu vermeli.
+    WorkerPool pool(counts.back());
+    for (int rt = 0; rt < RUNTIME_COUNT; rt++) {
+        printf("%-12s pi = %.10f, sum = %lld\n", runtime_names[rt],
+               pi_kernel((Runtime)rt, pool, counts.back()),
+               sum_kernel((Runtime)rt, pool, counts.back(), data));
+    }
+}
@@ -0,0 +1,194 @@
+#include <omp.h>
+#include <iostream>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+
+#include "per_thread.hpp"
+
+using namespace std;
+
+// parallel_for.cpp'de static ve dynamic arasında fark çıkmamıştı. Sebebi:
+// work() sadece i % 1000 == 0 olduğunda uyuyor ve bu iterasyonlar aralığa
+// eşit dağılmış; her thread'in static payına aynı sayıda "pahalı" iterasyon
+// düşüyor. Ayrıca sleep CPU kullanmadığı için thread sayısı çekirdek
+// sayısını geçse bile paralel görünüyor.
+//
+// Burada iş CPU'yu gerçekten meşgul eden bir döngü ve iterasyon maliyetleri
+// dört farklı profilden geliyor (hepsinde toplam iş aynı):
+//   uniform    → her iterasyon aynı
+//   linear     → maliyet i ile doğru orantılı (son iterasyonlar pahalı)
+//   heavy-tail → Pareto dağılımı: çoğu ucuz, birkaç tanesi çok pahalı
+//   clustered  → birkaç bitişik blok 50 kat pahalı
+//
+// Her profilde şu schedule'lar denenir:
+//   static, static,c, dynamic,c, guided, nonmonotonic:dynamic,c,
+//   taskloop grainsize(c)
+//
+// Raporlanan değerler:
+//   makespan → paralel bölgenin toplam süresi
+//   balance  → ortalama thread yükü / en yüklü thread'in yükü
+//              (thread başına yapılan iş birimi sayılır, zaman değil)
+//   overhead → makespan - en yüklü thread'in saf iş süresi;
+//              zamanlama, senkronizasyon ve bekleme maliyeti
+//
+// Not: thread sayısı çekirdek sayısını geçerse thread'ler sırayla çalışır ve
+// overhead anlamını yitirir; varsayılan thread sayısı çekirdek sayısıdır.
+//
+// g++ -std=c++20 -O2 -fopenmp schedule_lab.cpp -o schedule_lab
+// ./schedule_lab [threads] [chunk]
+
+const int N = 20000;
+const double MEAN_UNITS = 20;    // iterasyon başına ortalama iş birimi
+const int RUNS = 5;
+
+// Bir iş birimi: 64 adımlık bağımlı bir çarpma-toplama zinciri (~200 ns).
+// Sonuç döndürülür ki derleyici döngüyü silemesin.
+static double spin(int units) {
+    double x = 1.0;
+    for (int u = 0; u < units; u++) {
+        for (int k = 0; k < 64; k++) {
+            x = x * 0.999999 + 1e-7;
+        }
+    }
+    return x;
+}
+
+enum Profile { UNIFORM, LINEAR, HEAVY_TAIL, CLUSTERED, PROFILE_COUNT };
+const char* profile_names[PROFILE_COUNT] = {"uniform", "linear", "heavy-tail", "clustered"};
+
+vector<int> make_costs(Profile p) {
+    vector<double> w(N);
+    mt19937 rng(7);
+    switch (p) {
+        case UNIFORM:
+            fill(w.begin(), w.end(), 1.0);
+            break;
+        case LINEAR:
+            for (int i = 0; i < N; i++) w[i] = i + 1;
+            break;
+        case HEAVY_TAIL: {
+            // Pareto (alpha = 1.5): ortalama sonlu, varyans sonsuz.
+            uniform_real_distribution<double> u(0.0, 1.0);
+            for (int i = 0; i < N; i++) w[i] = pow(1.0 - u(rng), -1.0 / 1.5);
+            break;
+        }
+        case CLUSTERED: {
+            // 4 tane N/80 uzunluğunda blok, rastgele konumlarda.
+            fill(w.begin(), w.end(), 1.0);
+            uniform_int_distribution<int> pos(0, N - N / 80);
+            for (int c = 0; c < 4; c++) {
+                int start = pos(rng);
+                for (int i = start; i < start + N / 80; i++) w[i] = 50.0;
+            }
+            break;
+        }
+        default:
+            break;
+    }
+    // Toplam iş bütün profillerde N * MEAN_UNITS olsun.
+    double total = accumulate(w.begin(), w.end(), 0.0);
+    vector<int> units(N);
+    for (int i = 0; i < N; i++) {
+        units[i] = max(1, (int)lround(w[i] * N * MEAN_UNITS / total));
+    }
+    return units;
+}
+
+enum Schedule { STATIC, STATIC_C, DYNAMIC_C, GUIDED, NONMONOTONIC, TASKLOOP, SCHEDULE_COUNT };
+const char* schedule_names[SCHEDULE_COUNT] = {
+    "static", "static,c", "dynamic,c", "guided", "nonmonotonic:dyn,c", "taskloop grain c"};
+
+struct Result {
+    double makespan;
+    double balance;
+    double overhead;
+};
+
+Result run(Schedule s, const vector<int>& units, int threads, int chunk, double unit_sec) {
+    per_thread<long long> load(threads, 0);
+    double sink = 0;
+
+    double t0 = omp_get_wtime();
+    switch (s) {
+        case STATIC:
+            #pragma omp parallel for schedule(static) num_threads(threads) reduction(+:sink)
+            for (int i = 0; i < N; i++) { sink += spin(units[i]); load[omp_get_thread_num()] += units[i]; }
+            break;
+        case STATIC_C:
+            #pragma omp parallel for schedule(static, chunk) num_threads(threads) reduction(+:sink)
+            for (int i = 0; i < N; i++) { sink += spin(units[i]); load[omp_get_thread_num()] += units[i]; }
+            break;
+        case DYNAMIC_C:
+            #pragma omp parallel for schedule(monotonic: dynamic, chunk) num_threads(threads) reduction(+:sink)
+            for (int i = 0; i < N; i++) { sink += spin(units[i]); load[omp_get_thread_num()] += units[i]; }
+            break;
+        case GUIDED:
+            #pragma omp parallel for schedule(guided) num_threads(threads) reduction(+:sink)
+            for (int i = 0; i < N; i++) { sink += spin(units[i]); load[omp_get_thread_num()] += units[i]; }
+            break;
+        case NONMONOTONIC:
+            // Runtime'a iterasyonları sırasız dağıtma (work stealing) izni verir.
+            #pragma omp parallel for schedule(nonmonotonic: dynamic, chunk) num_threads(threads) reduction(+:sink)
+            for (int i = 0; i < N; i++) { sink += spin(units[i]); load[omp_get_thread_num()] += units[i]; }
+            break;
+        default:
+            #pragma omp parallel num_threads(threads)
+            #pragma omp single
+            #pragma omp taskloop grainsize(chunk) reduction(+:sink)
+            for (int i = 0; i < N; i++) { sink += spin(units[i]); load[omp_get_thread_num()] += units[i]; }
+            break;
+    }
+    double makespan = omp_get_wtime() - t0;
+    if (sink == 42.0) printf(" ");   // sink kullanılmış olsun
+
+    long long max_load = 0, total = 0;
+    load.for_each([&](long long l) { max_load = max(max_load, l); total += l; });
+    double balance = (double)total / threads / max_load;
+    return {makespan, balance, makespan - max_load * unit_sec};
+}
+
+int main(int argc, char** argv) {
+    int threads = argc > 1 ? atoi(argv[1]) : omp_get_num_procs();
+    int chunk = argc > 2 ? atoi(argv[2]) : 16;
+
+    printf("N = %d iterations, %.0f units/iter on average, %d threads, chunk = %d\n\n",
+           N, MEAN_UNITS, threads, chunk);
+
+    for (int p = 0; p < PROFILE_COUNT; p++) {
+        vector<int> units = make_costs((Profile)p);
+        int max_units = *max_element(units.begin(), units.end());
+        long long total_units = accumulate(units.begin(), units.end(), 0LL);
+
+        // Seri referans: aynı döngü OpenMP'siz. Bir iş biriminin süresi de
+        // buradan çıkar (ayrı bir kalibrasyon döngüsü farklı derlenebilir).
+        vector<double> serial;
+        for (int r = 0; r < RUNS; r++) {
+            double t0 = omp_get_wtime();
+            double sink = 0;
+            for (int i = 0; i < N; i++) sink += spin(units[i]);
+            serial.push_back(omp_get_wtime() - t0);
+            if (sink == 42.0) printf(" ");
+        }
+        sort(serial.begin(), serial.end());
+        double t1 = serial[RUNS / 2];
+        double unit_sec = t1 / total_units;
+
+        printf("=== %s (max iteration = %d units, serial %.2f ms, ideal %.2f ms) ===\n",
+               profile_names[p], max_units, t1 * 1e3, t1 / threads * 1e3);
+        printf("%-20s %12s %9s %10s %12s\n", "schedule", "makespan", "speedup", "balance", "overhead");
+
+        for (int s = 0; s < SCHEDULE_COUNT; s++) {
+            // Medyan makespan'li tekrarın değerleri
+            vector<Result> rs;
+            for (int r = 0; r < RUNS; r++) rs.push_back(run((Schedule)s, units, threads, chunk, unit_sec));
+            sort(rs.begin(), rs.end(), [](const Result& a, const Result& b) { return a.makespan < b.makespan; });
+            Result m = rs[RUNS / 2];
+            printf("%-20s %9.2f ms %8.2fx %9.1f%% %9.3f ms\n",
+                   schedule_names[s], m.makespan * 1e3, t1 / m.makespan, m.balance * 100.0, m.overhead * 1e3);
+        }
+        printf("\n");
+    }
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <thread>
+
+#include <sched.h>
+
+#include "per_thread.hpp"
+
+/*
+ * sharded_counter
+ * main.cpp'deki "#pragma omp atomic sum += 1" ya da tek bir std::atomic
+ * sayaç, her artırmada aynı cache line'ı çekirdekten çekirdeğe taşır
+ * (MESI: her yazma diğer kopyaları invalid eder). Thread sayısı arttıkça
+ * sayaç hızlanmak yerine yavaşlar.
+ *
+ * Burada sayaç shard'lara bölünür ve her shard per_thread ile ayrı bir
+ * cache line'da durur:
+ *   - shard_by::cpu    → shard = sched_getcpu(). Aynı çekirdekte çalışan
+ *                         thread'ler aynı shard'ı paylaşır, thread sayısından
+ *                         bağımsız olarak shard sayısı = CPU sayısı.
+ *   - shard_by::thread → her thread ilk kullanımda bir id alır (thread_local).
+ *                         Thread migration'dan etkilenmez.
+ * Artırma relaxed fetch_add'dir: shard'ı genelde tek bir çekirdek yazdığı
+ * için line o çekirdeğin cache'inde Modified durumda kalır ve ucuzdur.
+ * (Thread taşınabildiği için yine de atomik olmak zorunda.)
+ *
+ * read() bütün shard'ları toplar. Ucuz değildir (shard sayısı kadar cache
+ * miss) ve artırmalar devam ederken anlık (linearizable) bir değer değil,
+ * yaklaşık bir değer verir. İstatistik sayaçları için tam olarak istenen bu:
+ * sık yazılır, seyrek okunur.
+ */
+class sharded_counter {
+public:
+    enum class shard_by { cpu, thread };
+
+    explicit sharded_counter(shard_by mode = shard_by::cpu, std::size_t shards = 0)
+        : mode_(mode),
+          slots_(shards != 0 ? shards : default_shards()) {}
+
+    void add(long long n = 1) {
+        slots_[shard()].fetch_add(n, std::memory_order_relaxed);
+    }
+
+    sharded_counter& operator++() {
+        add(1);
+        return *this;
+    }
+
+    sharded_counter& operator+=(long long n) {
+        add(n);
+        return *this;
+    }
+
+    long long read() const {
+        long long total = 0;
+        for (std::size_t i = 0; i < slots_.size(); i++) {
+            total += slots_[i].load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    void reset() {
+        slots_.for_each([](std::atomic<long long>& s) { s.store(0, std::memory_order_relaxed); });
+    }
+
+    std::size_t shards() const { return slots_.size(); }
+
+private:
+    static std::size_t default_shards() {
+        unsigned n = std::thread::hardware_concurrency();
+        return n == 0 ? 1 : n;
+    }
+
+    static std::size_t thread_id() {
+        static std::atomic<std::size_t> next{0};
+        thread_local std::size_t id = next.fetch_add(1, std::memory_order_relaxed);
+        return id;
+    }
+
+    std::size_t shard() const {
+        if (mode_ == shard_by::cpu) {
+            // glibc'de sched_getcpu rseq/vDSO üzerinden syscall yapmadan döner.
+            int cpu = sched_getcpu();
+            return cpu < 0 ? 0 : static_cast<std::size_t>(cpu) % slots_.size();
+        }
+        return thread_id() % slots_.size();
+    }
+
+    shard_by mode_;
+    per_thread<std::atomic<long long>> slots_;
+};
@@ -0,0 +1,194 @@
+#include <omp.h>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+
+#include "simd_reduce.hpp"
+#include "first_touch.hpp"
+
+using namespace std;
+
+// simd_reduce.hpp'deki kernel'leri ölçüyoruz. Diziler cache'e sığmayacak
+// kadar büyük (256 MB), yani iyi bir kernel bellek bant genişliğiyle
+// sınırlanmalı. Her sonuç için GB/s ve "peak"in yüzdesi yazdırılır.
+//
+// Peak: en fazla thread ile sadece okuyup hiçbir hesap yapmayan bir döngünün
+// ulaştığı bant genişliği (ölçülen, pratik tepe). Makinenin teorik değeri
+// biliniyorsa ikinci argüman olarak verilebilir, yüzdeler ona göre hesaplanır
+// (örn. 2 kanal DDR4-3200: 2 x 8 byte x 3200 MT/s = 51.2 GB/s).
+//
+// Karşılaştırma için main.cpp'deki gibi int accumulator'lı reduction da
+// çalıştırılır; değerler büyük olduğu için sonucu taşar.
+//
+// g++ -std=c++20 -O2 -march=native -fopenmp simd_reduce.cpp -o simd_reduce
+// ./simd_reduce [threads] [peak GB/s]
+
+const size_t N = 1 << 26;   // 64M int32 = 256 MB
+const int RUNS = 5;
+
+template <typename F>
+double best_time(F f) {
+    double best = 1e30;
+    for (int r = 0; r < RUNS; r++) {
+        double t0 = omp_get_wtime();
+        f();
+        best = min(best, omp_get_wtime() - t0);
+    }
+    return best;
+}
+
+// splitmix64: index'ten deterministik sözde rastgele sayı, paralel doldurmak için.
+static uint64_t mix(uint64_t z) {
+    z += 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+// Peak ölçümü için sadece okuyan kernel. Sonuç kullanılmazsa derleyici
+// döngüyü siler, bu yüzden OR'lanıp döndürülür.
+static int32_t read_only(const int32_t* x, size_t n) {
+    int32_t acc = 0;
+    #pragma omp simd reduction(|:acc)
+    for (size_t i = 0; i < n; i++) acc |= x[i];
+    return acc;
+}
+
+static double peak = 0;
+
+// body çalıştırılıp süre ölçüldükten sonra check() çağrılır.
+template <typename Body, typename Check>
+void measure(const char* kernel, const char* variant, int threads, double bytes, Body body, Check check) {
+    double t = best_time(body);
+    bool ok = check();
+    double gbs = bytes / t / 1e9;
+    printf("%-6s %-16s %4d %9.2f ms %8.2f GB/s %6.1f%%%s\n", kernel, variant, threads,
+           t * 1e3, gbs, 100.0 * gbs / peak, ok ? "" : "  WRONG");
+}
+
+int main(int argc, char** argv) {
+    int threads = argc > 1 ? atoi(argv[1]) : omp_get_max_threads();
+    double theoretical = argc > 2 ? atof(argv[2]) : 0;
+    if (threads < 1) {
+        fprintf(stderr, "usage: %s [threads >= 1] [peak GB/s]\n", argv[0]);
+        return 1;
+    }
+    omp_set_num_threads(threads);
+
+#ifdef __AVX2__
+    printf("AVX2 kernels: intrinsics\n");
+#else
+    printf("AVX2 kernels: not compiled with -mavx2, falling back to omp simd\n");
+#endif
+
+    // first_touch: sayfalar onları okuyacak thread'lerin node'una düşer.
+    first_touch_vector<int32_t> x(N), y(N);
+    first_touch_vector<uint8_t> bytes(N);
+    first_touch_init(x.data(), N, [](long i) { return (int32_t)(mix(i) % 98304) - 32768; });
+    first_touch_init(y.data(), N, [](long i) { return (int32_t)(mix(i + N) % 98304) - 32768; });
+    first_touch_init(bytes.data(), N, [](long i) { return (uint8_t)mix(i + 2 * N); });
+
+    // Seri referans sonuçlar
+    int64_t ref_sum = 0, ref_dot = 0;
+    int32_t ref_min = INT32_MAX, ref_max = INT32_MIN;
+    vector<uint64_t> ref_hist(HIST_BINS, 0);
+    for (size_t i = 0; i < N; i++) {
+        ref_sum += x[i];
+        ref_dot += (int64_t)x[i] * y[i];
+        ref_min = min(ref_min, x[i]);
+        ref_max = max(ref_max, x[i]);
+        ref_hist[bytes[i]]++;
+    }
+
+    volatile int32_t sink;
+    double t_read = best_time([&] {
+        int32_t acc = 0;
+        #pragma omp parallel reduction(|:acc)
+        {
+            size_t b, e;
+            reduce_block(N, 16, omp_get_thread_num(), omp_get_num_threads(), b, e);
+            acc |= read_only(x.data() + b, e - b);
+        }
+        sink = acc;
+    });
+    (void)sink;
+    double measured = N * sizeof(int32_t) / t_read / 1e9;
+    peak = theoretical > 0 ? theoretical : measured;
+    printf("%d threads, %zu elements; read-only peak %.2f GB/s%s\n\n", threads, N, measured,
+           theoretical > 0 ? ", percentages against the given theoretical peak" : "");
+
+    printf("%-6s %-16s %4s %12s %13s %7s\n", "kernel", "variant", "thr", "time", "bandwidth", "peak");
+
+    const double B32 = N * sizeof(int32_t);
+
+    // main.cpp'deki gibi: int accumulator, tek zincir
+    int s32 = 0;
+    measure("sum", "int (main.cpp)", threads, B32, [&] {
+        s32 = 0;
+        #pragma omp parallel for reduction(+:s32)
+        for (size_t i = 0; i < N; i++) s32 += x[i];
+    }, [&] { return s32 == ref_sum; });
+
+    int64_t s64 = 0;
+    int32_t m32 = 0;
+    vector<uint64_t> hist(HIST_BINS);
+    auto sum_ok = [&] { return s64 == ref_sum; };
+    auto min_ok = [&] { return m32 == ref_min; };
+    auto max_ok = [&] { return m32 == ref_max; };
+    auto dot_ok = [&] { return s64 == ref_dot; };
+    auto hist_ok = [&] { return hist == ref_hist; };
+
+    // ---- sum ----
+    measure("sum", "omp simd", 1, B32, [&] { s64 = reduce_sum_simd(x.data(), N); }, sum_ok);
+    measure("sum", "avx2", 1, B32, [&] { s64 = reduce_sum_avx2(x.data(), N); }, sum_ok);
+    measure("sum", "MT x omp simd", threads, B32,
+            [&] { s64 = reduce_sum_parallel(x.data(), N, reduce_sum_simd); }, sum_ok);
+    measure("sum", "MT x avx2", threads, B32,
+            [&] { s64 = reduce_sum_parallel(x.data(), N, reduce_sum_avx2); }, sum_ok);
+
+    // ---- min ----
+    measure("min", "omp simd", 1, B32, [&] { m32 = reduce_min_simd(x.data(), N); }, min_ok);
+    measure("min", "avx2", 1, B32, [&] { m32 = reduce_min_avx2(x.data(), N); }, min_ok);
+    measure("min", "MT x omp simd", threads, B32,
+            [&] { m32 = reduce_min_parallel(x.data(), N, reduce_min_simd); }, min_ok);
+    measure("min", "MT x avx2", threads, B32,
+            [&] { m32 = reduce_min_parallel(x.data(), N, reduce_min_avx2); }, min_ok);
+
+    // ---- max ----
+    measure("max", "omp simd", 1, B32, [&] { m32 = reduce_max_simd(x.data(), N); }, max_ok);
+    measure("max", "avx2", 1, B32, [&] { m32 = reduce_max_avx2(x.data(), N); }, max_ok);
+    measure("max", "MT x omp simd", threads, B32,
+            [&] { m32 = reduce_max_parallel(x.data(), N, reduce_max_simd); }, max_ok);
+    measure("max", "MT x avx2", threads, B32,
+            [&] { m32 = reduce_max_parallel(x.data(), N, reduce_max_avx2); }, max_ok);
+
+    // ---- dot: iki dizi okunur ----
+    measure("dot", "omp simd", 1, 2 * B32, [&] { s64 = reduce_dot_simd(x.data(), y.data(), N); }, dot_ok);
+    measure("dot", "avx2", 1, 2 * B32, [&] { s64 = reduce_dot_avx2(x.data(), y.data(), N); }, dot_ok);
+    measure("dot", "MT x omp simd", threads, 2 * B32,
+            [&] { s64 = reduce_dot_parallel(x.data(), y.data(), N, reduce_dot_simd); }, dot_ok);
+    measure("dot", "MT x avx2", threads, 2 * B32,
+            [&] { s64 = reduce_dot_parallel(x.data(), y.data(), N, reduce_dot_avx2); }, dot_ok);
+
+    // ---- hist: N byte okunur; sayaç güncellemesi skaler olduğu için
+    // bant genişliğinin çok altında kalması beklenir ----
+    measure("hist", "omp simd", 1, N, [&] {
+        fill(hist.begin(), hist.end(), 0);
+        reduce_hist_simd(bytes.data(), N, hist.data());
+    }, hist_ok);
+    measure("hist", "avx2", 1, N, [&] {
+        fill(hist.begin(), hist.end(), 0);
+        reduce_hist_avx2(bytes.data(), N, hist.data());
+    }, hist_ok);
+    measure("hist", "MT x omp simd", threads, N, [&] {
+        fill(hist.begin(), hist.end(), 0);
+        reduce_hist_parallel(bytes.data(), N, hist.data(), reduce_hist_simd);
+    }, hist_ok);
+    measure("hist", "MT x avx2", threads, N, [&] {
+        fill(hist.begin(), hist.end(), 0);
+        reduce_hist_parallel(bytes.data(), N, hist.data(), reduce_hist_avx2);
+    }, hist_ok);
+}
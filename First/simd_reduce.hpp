@@ -0,0 +1,323 @@
+#pragma once
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <omp.h>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+/*
+ * simd_reduce
+ * main.cpp'deki reduction(+:sum) örneği int içinde topluyor: 100M x 5 = 500M
+ * sığıyor ama eleman değerleri biraz büyüse taşar. Ayrıca tek bir toplama
+ * zinciri var ve vektörleştirme tamamen derleyiciye bırakılmış.
+ *
+ * Burada int32 dizi üzerinde beş reduction, her biri üç şekilde yazıldı:
+ *   reduce_*_simd      → #pragma omp simd reduction, derleyici vektörleştirir
+ *   reduce_*_avx2      → aynı iş AVX2 intrinsic'leri ile elle yazılmış
+ *   reduce_*_parallel  → thread'ler arasında static bloklar, her blokta
+ *                        yukarıdaki SIMD kernel'lerinden biri (MT x SIMD)
+ *
+ *   sum   → int64 toplam (taşma yok: 2^32 eleman x 2^31 bile sığar)
+ *   min   → en küçük eleman
+ *   max   → en büyük eleman
+ *   dot   → x[i]*y[i] çarpımları int64 olarak, int64 toplam
+ *   hist  → uint8 değerlerin 256 kutulu histogramı, uint64 sayaçlar
+ *
+ * min/max için 64 bit accumulator gerekmez: sonuç zaten bir eleman, int32'de
+ * tam olarak temsil edilir; 64 bite genişletmek sadece vektör başına eleman
+ * sayısını yarıya düşürürdü.
+ *
+ * Toplamada tek accumulator kullanılırsa her vpaddq bir öncekini bekler
+ * (latency 1 cycle, ama load'lar ile birlikte zincir darboğaz olur).
+ * AVX2 sürümleri REDUCE_ACC bağımsız accumulator kullanır.
+ *
+ * __AVX2__ tanımlı değilse (-mavx2 / -march=native olmadan) *_avx2
+ * fonksiyonları *_simd sürümlerine düşer. AVX-512'li bir makinede
+ * -march=native ile omp simd sürümleri 512 bit register kullanabilir;
+ * o durumda elle yazılmış AVX2 kernel'inin geride kalması normaldir.
+ */
+
+constexpr int REDUCE_ACC = 4;
+constexpr int HIST_BINS = 256;
+// Histogram için alt-histogram sayısı (reduce_hist_avx2'ye bakın).
+constexpr int HIST_COPIES = 4;
+
+// ------------------------------------------------------------------
+// omp simd
+// ------------------------------------------------------------------
+
+inline int64_t reduce_sum_simd(const int32_t* x, std::size_t n) {
+    int64_t s = 0;
+    #pragma omp simd reduction(+:s)
+    for (std::size_t i = 0; i < n; i++) {
+        s += x[i];
+    }
+    return s;
+}
+
+inline int32_t reduce_min_simd(const int32_t* x, std::size_t n) {
+    int32_t m = INT32_MAX;
+    #pragma omp simd reduction(min:m)
+    for (std::size_t i = 0; i < n; i++) {
+        m = std::min(m, x[i]);
+    }
+    return m;
+}
+
+inline int32_t reduce_max_simd(const int32_t* x, std::size_t n) {
+    int32_t m = INT32_MIN;
+    #pragma omp simd reduction(max:m)
+    for (std::size_t i = 0; i < n; i++) {
+        m = std::max(m, x[i]);
+    }
+    return m;
+}
+
+inline int64_t reduce_dot_simd(const int32_t* x, const int32_t* y, std::size_t n) {
+    int64_t s = 0;
+    #pragma omp simd reduction(+:s)
+    for (std::size_t i = 0; i < n; i++) {
+        s += static_cast<int64_t>(x[i]) * y[i];
+    }
+    return s;
+}
+
+// Histogram vektörleşmez: aynı vektördeki iki eleman aynı kutuya düşebilir
+// (conflict) ve AVX2'de scatter yoktur. reduction(+:h[:256]) ile her SIMD
+// şeridine özel bir kopya verilir; GCC bunu doğru derler ama döngü skaler
+// kalır. Yine de kopyalar sayesinde ardışık aynı değerlerde
+// store -> load bağımlılığı (aynı sayaca art arda yazma) ortadan kalkar.
+inline void reduce_hist_simd(const uint8_t* x, std::size_t n, uint64_t* hist) {
+    #pragma omp simd reduction(+:hist[:HIST_BINS])
+    for (std::size_t i = 0; i < n; i++) {
+        hist[x[i]]++;
+    }
+}
+
+// ------------------------------------------------------------------
+// AVX2 intrinsics
+// ------------------------------------------------------------------
+
+#ifdef __AVX2__
+
+inline int64_t reduce_hsum_epi64(__m256i v) {
+    __m128i s = _mm_add_epi64(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    return _mm_cvtsi128_si64(s) + _mm_extract_epi64(s, 1);
+}
+
+// 8 int32 → iki 4'lü int64 vektörü (vpmovsxdq), REDUCE_ACC zincirde toplanır.
+inline int64_t reduce_sum_avx2(const int32_t* x, std::size_t n) {
+    __m256i acc[REDUCE_ACC];
+    for (int k = 0; k < REDUCE_ACC; k++) acc[k] = _mm256_setzero_si256();
+
+    // Döngü sonu önceden hesaplanır; kalan < 8 * REDUCE_ACC eleman skaler.
+    const std::size_t body = n - n % (8 * REDUCE_ACC);
+    std::size_t i = 0;
+    for (; i < body; i += 8 * REDUCE_ACC) {
+        for (int k = 0; k < REDUCE_ACC; k++) {
+            // İki 128 bit load: vpmovsxdq doğrudan bellekten okur, 256 bit
+            // load + vextracti128'e göre bir shuffle uop'u daha az.
+            const int32_t* p = x + i + 8 * k;
+            __m256i lo = _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+            __m256i hi = _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 4)));
+            acc[k] = _mm256_add_epi64(acc[k], _mm256_add_epi64(lo, hi));
+        }
+    }
+    for (int k = 1; k < REDUCE_ACC; k++) acc[0] = _mm256_add_epi64(acc[0], acc[k]);
+    int64_t s = reduce_hsum_epi64(acc[0]);
+    for (; i < n; i++) s += x[i];
+    return s;
+}
+
+inline int32_t reduce_min_avx2(const int32_t* x, std::size_t n) {
+    __m256i acc[REDUCE_ACC];
+    for (int k = 0; k < REDUCE_ACC; k++) acc[k] = _mm256_set1_epi32(INT32_MAX);
+
+    const std::size_t body = n - n % (8 * REDUCE_ACC);
+    std::size_t i = 0;
+    for (; i < body; i += 8 * REDUCE_ACC) {
+        for (int k = 0; k < REDUCE_ACC; k++) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i + 8 * k));
+            acc[k] = _mm256_min_epi32(acc[k], v);
+        }
+    }
+    for (int k = 1; k < REDUCE_ACC; k++) acc[0] = _mm256_min_epi32(acc[0], acc[k]);
+    int32_t lanes[8];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc[0]);
+    int32_t m = *std::min_element(lanes, lanes + 8);
+    for (; i < n; i++) m = std::min(m, x[i]);
+    return m;
+}
+
+inline int32_t reduce_max_avx2(const int32_t* x, std::size_t n) {
+    __m256i acc[REDUCE_ACC];
+    for (int k = 0; k < REDUCE_ACC; k++) acc[k] = _mm256_set1_epi32(INT32_MIN);
+
+    const std::size_t body = n - n % (8 * REDUCE_ACC);
+    std::size_t i = 0;
+    for (; i < body; i += 8 * REDUCE_ACC) {
+        for (int k = 0; k < REDUCE_ACC; k++) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i + 8 * k));
+            acc[k] = _mm256_max_epi32(acc[k], v);
+        }
+    }
+    for (int k = 1; k < REDUCE_ACC; k++) acc[0] = _mm256_max_epi32(acc[0], acc[k]);
+    int32_t lanes[8];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc[0]);
+    int32_t m = *std::max_element(lanes, lanes + 8);
+    for (; i < n; i++) m = std::max(m, x[i]);
+    return m;
+}
+
+// vpmuldq (_mm256_mul_epi32) her 64 bitlik şeridin alt 32 bitini işaretli
+// çarpıp 64 bit sonuç verir. Çift indisli elemanlar doğrudan, tek indisliler
+// 32 bit sağa kaydırılarak çarpılır; 32x32 → 64 çarpım hiç taşmaz.
+inline int64_t reduce_dot_avx2(const int32_t* x, const int32_t* y, std::size_t n) {
+    __m256i acc[REDUCE_ACC];
+    for (int k = 0; k < REDUCE_ACC; k++) acc[k] = _mm256_setzero_si256();
+
+    const std::size_t body = n - n % (8 * REDUCE_ACC);
+    std::size_t i = 0;
+    for (; i < body; i += 8 * REDUCE_ACC) {
+        for (int k = 0; k < REDUCE_ACC; k++) {
+            __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i + 8 * k));
+            __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(y + i + 8 * k));
+            __m256i even = _mm256_mul_epi32(a, b);
+            __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+            acc[k] = _mm256_add_epi64(acc[k], _mm256_add_epi64(even, odd));
+        }
+    }
+    for (int k = 1; k < REDUCE_ACC; k++) acc[0] = _mm256_add_epi64(acc[0], acc[k]);
+    int64_t s = reduce_hsum_epi64(acc[0]);
+    for (; i < n; i++) s += static_cast<int64_t>(x[i]) * y[i];
+    return s;
+}
+
+// AVX2'de scatter ve conflict detection (AVX-512CD) olmadığı için sayaç
+// güncellemesi skaler kalır. SIMD'nin katkısı: 32 byte tek load ile okunur,
+// byte'lar register'dan çıkarılır ve HIST_COPIES alt-histograma dağıtılır.
+// Böylece ardışık eşit değerler farklı sayaçlara yazar ve birbirini
+// beklemez. Sonda alt-histogramlar toplanır.
+inline void reduce_hist_avx2(const uint8_t* x, std::size_t n, uint64_t* hist) {
+    static_assert(HIST_COPIES == 4, "the unrolled loop below assumes 4 copies");
+    alignas(64) uint64_t sub[HIST_COPIES][HIST_BINS] = {};
+
+    const std::size_t body = n - n % 32;
+    std::size_t i = 0;
+    for (; i < body; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i));
+        uint64_t q[4];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(q), v);
+        // Döngü yerine açık yazıldı: GCC iç içe kısa döngüleri açmayınca
+        // kaydırma miktarları sabit olmuyor ve kernel ~2 kat yavaşlıyordu.
+        for (int w = 0; w < 4; w++) {
+            uint64_t b = q[w];
+            sub[0][b & 0xff]++;
+            sub[1][(b >> 8) & 0xff]++;
+            sub[2][(b >> 16) & 0xff]++;
+            sub[3][(b >> 24) & 0xff]++;
+            sub[0][(b >> 32) & 0xff]++;
+            sub[1][(b >> 40) & 0xff]++;
+            sub[2][(b >> 48) & 0xff]++;
+            sub[3][b >> 56]++;
+        }
+    }
+    for (; i < n; i++) sub[0][x[i]]++;
+    for (int b = 0; b < HIST_BINS; b++) {
+        uint64_t total = 0;
+        for (int c = 0; c < HIST_COPIES; c++) total += sub[c][b];
+        hist[b] += total;
+    }
+}
+
+#else
+
+inline int64_t reduce_sum_avx2(const int32_t* x, std::size_t n) { return reduce_sum_simd(x, n); }
+inline int32_t reduce_min_avx2(const int32_t* x, std::size_t n) { return reduce_min_simd(x, n); }
+inline int32_t reduce_max_avx2(const int32_t* x, std::size_t n) { return reduce_max_simd(x, n); }
+inline int64_t reduce_dot_avx2(const int32_t* x, const int32_t* y, std::size_t n) {
+    return reduce_dot_simd(x, y, n);
+}
+inline void reduce_hist_avx2(const uint8_t* x, std::size_t n, uint64_t* hist) {
+    reduce_hist_simd(x, n, hist);
+}
+
+#endif
+
+// ------------------------------------------------------------------
+// Thread x SIMD
+// ------------------------------------------------------------------
+
+// Thread t'nin bloğu [begin, end); sınırlar 64 byte'a (16 int32) yuvarlanır,
+// böylece iki thread aynı cache line'ı okumaz ve her blok hizalı başlar.
+inline void reduce_block(std::size_t n, std::size_t align, int t, int nt,
+                         std::size_t& begin, std::size_t& end) {
+    std::size_t chunks = (n + align - 1) / align;
+    begin = std::min(n, chunks * t / nt * align);
+    end = std::min(n, chunks * (t + 1) / nt * align);
+}
+
+template <typename Kernel>
+int64_t reduce_sum_parallel(const int32_t* x, std::size_t n, Kernel kernel) {
+    int64_t s = 0;
+    #pragma omp parallel reduction(+:s)
+    {
+        std::size_t b, e;
+        reduce_block(n, 16, omp_get_thread_num(), omp_get_num_threads(), b, e);
+        s += kernel(x + b, e - b);
+    }
+    return s;
+}
+
+template <typename Kernel>
+int32_t reduce_min_parallel(const int32_t* x, std::size_t n, Kernel kernel) {
+    int32_t m = INT32_MAX;
+    #pragma omp parallel reduction(min:m)
+    {
+        std::size_t b, e;
+        reduce_block(n, 16, omp_get_thread_num(), omp_get_num_threads(), b, e);
+        m = std::min(m, kernel(x + b, e - b));
+    }
+    return m;
+}
+
+template <typename Kernel>
+int32_t reduce_max_parallel(const int32_t* x, std::size_t n, Kernel kernel) {
+    int32_t m = INT32_MIN;
+    #pragma omp parallel reduction(max:m)
+    {
+        std::size_t b, e;
+        reduce_block(n, 16, omp_get_thread_num(), omp_get_num_threads(), b, e);
+        m = std::max(m, kernel(x + b, e - b));
+    }
+    return m;
+}
+
+template <typename Kernel>
+int64_t reduce_dot_parallel(const int32_t* x, const int32_t* y, std::size_t n, Kernel kernel) {
+    int64_t s = 0;
+    #pragma omp parallel reduction(+:s)
+    {
+        std::size_t b, e;
+        reduce_block(n, 16, omp_get_thread_num(), omp_get_num_threads(), b, e);
+        s += kernel(x + b, y + b, e - b);
+    }
+    return s;
+}
+
+// Her thread kendi yerel histogramını doldurur; paylaşılan sayaçlara
+// atomic yazmak yerine sonda array reduction ile birleştirilir.
+template <typename Kernel>
+void reduce_hist_parallel(const uint8_t* x, std::size_t n, uint64_t* hist, Kernel kernel) {
+    #pragma omp parallel reduction(+:hist[:HIST_BINS])
+    {
+        std::size_t b, e;
+        reduce_block(n, 64, omp_get_thread_num(), omp_get_num_threads(), b, e);
+        kernel(x + b, e - b, hist);
+    }
+}
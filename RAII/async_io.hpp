@@ -0,0 +1,531 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include "worker_pool.hpp"
+
+/*
+ * AsyncFileIO
+ * Pool thread'lerinde blocking read/write yapmak o thread'i diskin hızına
+ * bağlar: thread uyurken kuyruğundaki işler de bekler. Burada okuma/yazma
+ * isteği kernel'e verilir ve tamamlandığında bekleyen iş pool üzerinde
+ * devam ettirilir.
+ *
+ * - Backend::IoUring: her pool için tek bir io_uring. İstekler SQ (submission
+ *   queue) üzerinden gönderilir, tek bir completion thread'i CQ'dan sonuçları
+ *   toplar ve callback'i pool'a submit eder. liburing kullanılmıyor, ring
+ *   doğrudan io_uring_setup / io_uring_enter syscall'ları ile kuruluyor.
+ * - Backend::Threads: io_uring yoksa (eski kernel, seccomp ile kapatılmış
+ *   container) küçük bir I/O thread grubu pread/pwrite yapar. Pool thread'leri
+ *   yine bloklanmaz, sadece bu ayrı thread'ler bloklanır.
+ *
+ * Sonuçlar read(2)/write(2) gibidir: aktarılan byte sayısı ya da -errno.
+ * 4 GiB ve üstü istekler (SQE len alanı 32 bit) -EINVAL ile döner.
+ * Kısa okuma/yazma (short read) durumunu çağıran taraf kontrol etmelidir.
+ *
+ * Bekleme şekilleri:
+ *   - callback: on_done(result) pool üzerinde çalışır
+ *   - future:   std::future<ssize_t>
+ *   - read_wait / write_wait: fiber içinde fiber park edilir, normal
+ *     thread'de thread bloklanır
+ *   - co_await read_async(...): coroutine pool üzerinde devam eder
+ */
+class AsyncFileIO {
+public:
+    using Callback = std::function<void(ssize_t)>;
+
+    enum class Backend {
+        Auto,      // io_uring varsa (READ/WRITE destekli) onu, yoksa thread grubunu kullan
+        IoUring,   // io_uring kurulamazsa std::system_error fırlatır
+        Threads
+    };
+
+    explicit AsyncFileIO(WorkerPool& pool, Backend backend = Backend::Auto,
+                         unsigned entries = 256, std::size_t fallback_threads = 4)
+        : pool_(pool) {
+        int ring_error = backend == Backend::Threads ? 0 : setup_ring(entries);
+        if (backend == Backend::IoUring && ring_error != 0) {
+            // Açıkça istenen backend sessizce değiştirilmez.
+            throw std::system_error(ring_error, std::generic_category(), "io_uring unavailable");
+        }
+        if (backend != Backend::Threads && ring_error == 0) {
+            backend_ = Backend::IoUring;
+            completion_thread_ = std::thread(&AsyncFileIO::reap_completions, this);
+        } else {
+            backend_ = Backend::Threads;
+            for (std::size_t i = 0; i < (fallback_threads == 0 ? 1 : fallback_threads); i++) {
+                io_threads_.emplace_back(&AsyncFileIO::io_thread_main, this);
+            }
+        }
+    }
+
+    // Destructor: gönderilmiş tüm istekler tamamlanana kadar bekler.
+    ~AsyncFileIO() {
+        if (backend_ == Backend::IoUring) {
+            // NOP isteği completion thread'ini io_uring_enter'dan uyandırır.
+            {
+                std::unique_lock<std::mutex> lock(sq_mtx_);
+                stop_ = true;
+            }
+            submit_sqe(IORING_OP_NOP, -1, nullptr, 0, 0, nullptr);
+            completion_thread_.join();
+            munmap(sqes_, sqes_size_);
+            if (cq_ptr_ != sq_ptr_) {
+                munmap(cq_ptr_, cq_size_);
+            }
+            munmap(sq_ptr_, sq_size_);
+            close(ring_fd_);
+        } else {
+            {
+                std::lock_guard<std::mutex> lock(job_mtx_);
+                stop_ = true;
+            }
+            job_cv_.notify_all();
+            for (auto& t : io_threads_) {
+                t.join();
+            }
+        }
+    }
+
+    AsyncFileIO(const AsyncFileIO&) = delete;
+    AsyncFileIO& operator=(const AsyncFileIO&) = delete;
+
+    Backend backend() const { return backend_; }
+
+    // ---------------- callback ----------------
+
+    void read(int fd, void* buf, std::size_t len, off_t offset, Callback on_done) {
+        submit(IORING_OP_READ, fd, buf, len, offset, make_pool_callback(std::move(on_done)));
+    }
+
+    void write(int fd, const void* buf, std::size_t len, off_t offset, Callback on_done) {
+        submit(IORING_OP_WRITE, fd, const_cast<void*>(buf), len, offset,
+               make_pool_callback(std::move(on_done)));
+    }
+
+    // ---------------- future ----------------
+
+    std::future<ssize_t> read(int fd, void* buf, std::size_t len, off_t offset) {
+        auto promise = std::make_shared<std::promise<ssize_t>>();
+        auto future = promise->get_future();
+        submit(IORING_OP_READ, fd, buf, len, offset,
+               new Callback([promise](ssize_t r) { promise->set_value(r); }));
+        return future;
+    }
+
+    std::future<ssize_t> write(int fd, const void* buf, std::size_t len, off_t offset) {
+        auto promise = std::make_shared<std::promise<ssize_t>>();
+        auto future = promise->get_future();
+        submit(IORING_OP_WRITE, fd, const_cast<void*>(buf), len, offset,
+               new Callback([promise](ssize_t r) { promise->set_value(r); }));
+        return future;
+    }
+
+    // ---------------- fiber / thread bekleme ----------------
+
+    ssize_t read_wait(int fd, void* buf, std::size_t len, off_t offset) {
+        return wait(IORING_OP_READ, fd, buf, len, offset);
+    }
+
+    ssize_t write_wait(int fd, const void* buf, std::size_t len, off_t offset) {
+        return wait(IORING_OP_WRITE, fd, const_cast<void*>(buf), len, offset);
+    }
+
+    // ---------------- coroutine ----------------
+
+    struct Awaitable {
+        AsyncFileIO* io;
+        unsigned op;
+        int fd;
+        void* buf;
+        std::size_t len;
+        off_t offset;
+        ssize_t result = 0;
+
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> h) {
+            io->submit(op, fd, buf, len, offset, io->make_pool_callback([this, h](ssize_t r) {
+                result = r;
+                h.resume();
+            }));
+        }
+
+        ssize_t await_resume() const noexcept { return result; }
+    };
+
+    Awaitable read_async(int fd, void* buf, std::size_t len, off_t offset) {
+        return Awaitable{this, IORING_OP_READ, fd, buf, len, offset};
+    }
+
+    Awaitable write_async(int fd, const void* buf, std::size_t len, off_t offset) {
+        return Awaitable{this, IORING_OP_WRITE, fd, const_cast<void*>(buf), len, offset};
+    }
+
+private:
+    // Callback heap'te tutulur ve pointer'ı io_uring user_data'sına yazılır.
+    // Callback completion thread'inde çalışır, sonuç fonksiyonuna göre pool'a
+    // aktarılır ya da (fiber uyandırma gibi ucuz işlerde) doğrudan çalışır.
+    Callback* make_pool_callback(Callback on_done) {
+        WorkerPool* pool = &pool_;
+        return new Callback([pool, cb = std::move(on_done)](ssize_t r) mutable {
+            pool->submit([cb = std::move(cb), r] { cb(r); });
+        });
+    }
+
+    ssize_t wait(unsigned op, int fd, void* buf, std::size_t len, off_t offset) {
+        // State bekleyenin stack'inde durur. notify() çağrıldıktan sonra
+        // completion tarafı state'e dokunmamalı.
+        struct State {
+            FiberSpinLock guard;
+            FiberWaiter waiter;
+            ssize_t result = 0;
+            bool done = false;
+            bool blocked = false;
+        } st;
+
+        submit(op, fd, buf, len, offset, new Callback([&st](ssize_t r) {
+            st.guard.lock();
+            st.result = r;
+            st.done = true;
+            bool wake = st.blocked;
+            st.guard.unlock();
+            if (wake) {
+                // Fiber ise kendi worker'ının ready kuyruğuna döner.
+                st.waiter.notify();
+            }
+        }));
+
+        st.guard.lock();
+        if (!st.done) {
+            st.blocked = true;
+            st.waiter.block(st.guard);
+        } else {
+            st.guard.unlock();
+        }
+        return st.result;
+    }
+
+    void submit(unsigned op, int fd, void* buf, std::size_t len, off_t offset, Callback* cb) {
+        // SQE'nin len alanı 32 bit; daha büyük istek kırpılmak yerine
+        // reddedilir. İki backend aynı davransın diye burada kontrol edilir.
+        if (len > std::numeric_limits<__u32>::max()) {
+            fail(cb, EINVAL);
+            return;
+        }
+        if (backend_ == Backend::IoUring) {
+            submit_sqe(op, fd, buf, len, offset, cb);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(job_mtx_);
+            jobs_.push_back(Job{op, fd, buf, len, offset, cb});
+        }
+        job_cv_.notify_one();
+    }
+
+    // ================= io_uring =================
+
+    static int io_uring_setup(unsigned entries, io_uring_params* p) {
+        return static_cast<int>(syscall(__NR_io_uring_setup, entries, p));
+    }
+
+    static int io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags) {
+        return static_cast<int>(syscall(__NR_io_uring_enter, fd, to_submit, min_complete,
+                                        flags, nullptr, 0));
+    }
+
+    static int io_uring_register(int fd, unsigned opcode, void* arg, unsigned nr_args) {
+        return static_cast<int>(syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+    }
+
+    // IORING_OP_READ/WRITE 5.6'da geldi; 5.1-5.5'te ring kurulur ama her
+    // istek -EINVAL döner. IORING_REGISTER_PROBE da 5.6'da geldiği için
+    // probe'un başarısız olması da "desteklenmiyor" demektir.
+    bool ops_supported() {
+        constexpr unsigned OPS = 256;
+        std::vector<char> mem(sizeof(io_uring_probe) + OPS * sizeof(io_uring_probe_op), 0);
+        auto* probe = reinterpret_cast<io_uring_probe*>(mem.data());
+        if (io_uring_register(ring_fd_, IORING_REGISTER_PROBE, probe, OPS) < 0) {
+            return false;
+        }
+        for (unsigned op : {IORING_OP_READ, IORING_OP_WRITE, IORING_OP_NOP}) {
+            if (op > probe->last_op || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // 0 ya da kurulumun neden olmadığını anlatan errno döner.
+    int setup_ring(unsigned entries) {
+        io_uring_params p;
+        std::memset(&p, 0, sizeof(p));
+        ring_fd_ = io_uring_setup(entries, &p);
+        if (ring_fd_ < 0) {
+            return errno;
+        }
+        if (!ops_supported()) {
+            close(ring_fd_);
+            return EOPNOTSUPP;
+        }
+
+        sq_size_ = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+        cq_size_ = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+        bool single_mmap = p.features & IORING_FEAT_SINGLE_MMAP;
+        if (single_mmap) {
+            sq_size_ = cq_size_ = std::max(sq_size_, cq_size_);
+        }
+
+        sq_ptr_ = mmap(nullptr, sq_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                       ring_fd_, IORING_OFF_SQ_RING);
+        if (sq_ptr_ == MAP_FAILED) {
+            int err = errno;
+            close(ring_fd_);
+            return err;
+        }
+        cq_ptr_ = single_mmap ? sq_ptr_
+                              : mmap(nullptr, cq_size_, PROT_READ | PROT_WRITE,
+                                     MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+        sqes_size_ = p.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                          ring_fd_, IORING_OFF_SQES);
+        if (cq_ptr_ == MAP_FAILED || sqes == MAP_FAILED) {
+            int err = errno;
+            if (sqes != MAP_FAILED) munmap(sqes, sqes_size_);
+            if (cq_ptr_ != MAP_FAILED && cq_ptr_ != sq_ptr_) munmap(cq_ptr_, cq_size_);
+            munmap(sq_ptr_, sq_size_);
+            close(ring_fd_);
+            return err;
+        }
+        sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+        char* sq = static_cast<char*>(sq_ptr_);
+        sq_head_  = reinterpret_cast<unsigned*>(sq + p.sq_off.head);
+        sq_tail_  = reinterpret_cast<unsigned*>(sq + p.sq_off.tail);
+        sq_mask_  = *reinterpret_cast<unsigned*>(sq + p.sq_off.ring_mask);
+        sq_array_ = reinterpret_cast<unsigned*>(sq + p.sq_off.array);
+
+        char* cq = static_cast<char*>(cq_ptr_);
+        cq_head_ = reinterpret_cast<unsigned*>(cq + p.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned*>(cq + p.cq_off.tail);
+        cq_mask_ = *reinterpret_cast<unsigned*>(cq + p.cq_off.ring_mask);
+        cqes_    = reinterpret_cast<io_uring_cqe*>(cq + p.cq_off.cqes);
+
+        // CQ taşmasın diye aynı anda uçuşta olan istek sayısı SQ boyutu ile sınırlı.
+        max_inflight_ = p.sq_entries;
+        return 0;
+    }
+
+    /*
+     * submit_sqe() → SQ'nun kuyruğuna bir istek yazılır.
+     * Birden fazla pool thread'i aynı anda submit edebileceği için SQ
+     * tarafı bir mutex ile korunur. Kernel ile paylaşılan head/tail
+     * değerleri acquire/release ile okunup yazılır.
+     *
+     * io_uring_enter başarısız olursa ve kernel SQE'yi almadıysa istek geri
+     * alınır (tail ve inflight_ eski haline döner) ve callback -errno ile
+     * çağrılır; aksi halde tamamlanmayı bekleyen biri sonsuza kadar bekler.
+     */
+    void submit_sqe(unsigned op, int fd, void* buf, std::size_t len, off_t offset, Callback* cb) {
+        std::unique_lock<std::mutex> lock(sq_mtx_);
+        sq_cv_.wait(lock, [this] { return inflight_ < max_inflight_ || ring_error_ != 0; });
+        if (ring_error_ != 0) {
+            int err = ring_error_;
+            lock.unlock();
+            fail(cb, err);
+            return;
+        }
+
+        unsigned tail = *sq_tail_;
+        unsigned idx = tail & sq_mask_;
+        io_uring_sqe* sqe = &sqes_[idx];
+        std::memset(sqe, 0, sizeof(*sqe));
+        sqe->opcode = static_cast<__u8>(op);
+        sqe->fd = fd;
+        sqe->addr = reinterpret_cast<__u64>(buf);
+        sqe->len = static_cast<__u32>(len);
+        sqe->off = static_cast<__u64>(offset);
+        sqe->user_data = reinterpret_cast<__u64>(cb);
+        sq_array_[idx] = idx;
+        std::atomic_ref<unsigned>(*sq_tail_).store(tail + 1, std::memory_order_release);
+        inflight_++;
+        if (cb != nullptr) {
+            pending_.insert(cb);
+        }
+
+        int ret;
+        do {
+            ret = io_uring_enter(ring_fd_, 1, 0, 0);
+        } while (ret < 0 && errno == EINTR);
+        if (ret >= 1) {
+            return;
+        }
+        int err = ret < 0 ? errno : EAGAIN;
+        if (std::atomic_ref<unsigned>(*sq_head_).load(std::memory_order_acquire) != tail) {
+            return;   // kernel SQE'yi aldı, sonuç CQ'dan gelecek
+        }
+        std::atomic_ref<unsigned>(*sq_tail_).store(tail, std::memory_order_release);
+        inflight_--;
+        pending_.erase(cb);
+        lock.unlock();
+        sq_cv_.notify_all();
+        fail(cb, err);
+    }
+
+    static void fail(Callback* cb, int err) {
+        if (cb != nullptr) {
+            (*cb)(-err);
+            delete cb;
+        }
+    }
+
+    /*
+     * EINTR / EAGAIN / EBUSY geçicidir, CQ yine okunur. Başka bir hata ring'in
+     * kullanılamaz olduğu anlamına gelir: CQ'da kalanlar işlendikten sonra
+     * bekleyen bütün callback'ler -errno ile çağrılır ve sonraki istekler
+     * doğrudan aynı hata ile döner. pending_ bu yüzden tutulur; callback'ler
+     * sadece kernel'in elindeki SQE'lerin user_data'sında olsaydı bu durumda
+     * kaybolurlardı.
+     */
+    void reap_completions() {
+        while (true) {
+            int ret = io_uring_enter(ring_fd_, 0, 1, IORING_ENTER_GETEVENTS);
+            int fatal = 0;
+            if (ret < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                fatal = errno;
+            }
+
+            unsigned head = *cq_head_;
+            unsigned tail = std::atomic_ref<unsigned>(*cq_tail_).load(std::memory_order_acquire);
+            std::vector<std::pair<Callback*, int>> done;
+            for (; head != tail; head++) {
+                const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+                done.emplace_back(reinterpret_cast<Callback*>(cqe.user_data), cqe.res);
+            }
+            std::atomic_ref<unsigned>(*cq_head_).store(head, std::memory_order_release);
+
+            std::vector<Callback*> orphaned;
+            bool finished;
+            {
+                std::lock_guard<std::mutex> lock(sq_mtx_);
+                inflight_ -= static_cast<unsigned>(done.size());
+                for (auto& [cb, res] : done) {
+                    pending_.erase(cb);
+                }
+                if (fatal != 0) {
+                    ring_error_ = fatal;
+                    orphaned.assign(pending_.begin(), pending_.end());
+                    pending_.clear();
+                    inflight_ = 0;
+                }
+                finished = fatal != 0 || (stop_ && inflight_ == 0);
+            }
+            if (!done.empty() || fatal != 0) {
+                sq_cv_.notify_all();
+            }
+            for (auto& [cb, res] : done) {
+                if (cb != nullptr) {
+                    (*cb)(res);
+                    delete cb;
+                }
+            }
+            for (Callback* cb : orphaned) {
+                fail(cb, fatal);
+            }
+            if (finished) {
+                break;
+            }
+        }
+    }
+
+    // ================= thread fallback =================
+
+    struct Job {
+        unsigned op;
+        int fd;
+        void* buf;
+        std::size_t len;
+        off_t offset;
+        Callback* cb;
+    };
+
+    void io_thread_main() {
+        while (true) {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(job_mtx_);
+                job_cv_.wait(lock, [this] { return stop_ || !jobs_.empty(); });
+                if (jobs_.empty()) {
+                    return;
+                }
+                job = jobs_.front();
+                jobs_.pop_front();
+            }
+            ssize_t r = job.op == IORING_OP_READ ? pread(job.fd, job.buf, job.len, job.offset)
+                                                 : pwrite(job.fd, job.buf, job.len, job.offset);
+            if (r < 0) {
+                r = -errno;
+            }
+            (*job.cb)(r);
+            delete job.cb;
+        }
+    }
+
+    WorkerPool& pool_;
+    Backend backend_ = Backend::Threads;
+    bool stop_ = false;
+
+    // io_uring
+    int ring_fd_ = -1;
+    void* sq_ptr_ = nullptr;
+    void* cq_ptr_ = nullptr;
+    std::size_t sq_size_ = 0;
+    std::size_t cq_size_ = 0;
+    std::size_t sqes_size_ = 0;
+    io_uring_sqe* sqes_ = nullptr;
+    unsigned* sq_head_ = nullptr;
+    unsigned* sq_tail_ = nullptr;
+    unsigned* sq_array_ = nullptr;
+    unsigned sq_mask_ = 0;
+    unsigned* cq_head_ = nullptr;
+    unsigned* cq_tail_ = nullptr;
+    unsigned cq_mask_ = 0;
+    io_uring_cqe* cqes_ = nullptr;
+
+    std::mutex sq_mtx_;
+    std::condition_variable sq_cv_;
+    unsigned inflight_ = 0;
+    unsigned max_inflight_ = 0;
+    std::unordered_set<Callback*> pending_;   // kernel'de olan istekler
+    int ring_error_ = 0;                      // ring kullanılamaz hale geldiyse errno
+    std::thread completion_thread_;
+
+    // thread fallback
+    std::mutex job_mtx_;
+    std::condition_variable job_cv_;
+    std::deque<Job> jobs_;
+    std::vector<std::thread> io_threads_;
+};
@@ -0,0 +1,253 @@
+// AsyncFileIO için büyük sıralı (sequential) dosya throughput karşılaştırması.
+//
+// Üç yöntem aynı dosyayı 1 MB'lık parçalar halinde okur:
+//   1) Pool thread'lerinde blocking pread
+//   2) AsyncFileIO + io_uring
+//   3) AsyncFileIO + blocking I/O thread grubu (fallback)
+// Her okuma sırasında pool'a küçük işler de gönderilir ve bu işlerin ne
+// kadar beklediği ölçülür. Blocking pread pool thread'lerini uyuttuğu için
+// asıl kayıp burada görünür.
+//
+// g++ -std=c++20 -O2 -pthread async_io_benchmark.cpp -o async_io_benchmark
+// ./async_io_benchmark [dosya_boyutu_MB] [dosya_yolu]
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <future>
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <coroutine>
+#include <exception>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "async_io.hpp"
+
+using namespace std::chrono;
+
+constexpr std::size_t CHUNK = 1 << 20;        // 1 MB
+constexpr std::size_t QUEUE_DEPTH = 32;       // aynı anda uçuşta olan istek sayısı
+
+// Dosyayı page cache'ten düşürür, böylece her ölçüm diskten okur.
+// Container içinde etkisi olmayabilir, o durumda sonuçlar page cache hızıdır.
+void drop_cache(int fd) {
+    fdatasync(fd);
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+}
+
+// Okuma sırasında pool'a her 1 ms'de bir küçük iş gönderir ve
+// işin çalışmaya başlamasına kadar geçen en kötü süreyi döndürür.
+class LatencyProbe {
+public:
+    explicit LatencyProbe(WorkerPool& pool) : pool_(pool), thread_([this] { run(); }) {}
+
+    double stop_and_get_max_us() {
+        stop_ = true;
+        thread_.join();
+        return max_us_;
+    }
+
+private:
+    void run() {
+        while (!stop_) {
+            auto sent = steady_clock::now();
+            auto f = pool_.submit([sent] {
+                return duration<double, std::micro>(steady_clock::now() - sent).count();
+            });
+            max_us_ = std::max(max_us_, f.get());
+            std::this_thread::sleep_for(milliseconds(1));
+        }
+    }
+
+    WorkerPool& pool_;
+    std::atomic<bool> stop_{false};
+    double max_us_ = 0;
+    std::thread thread_;
+};
+
+void report(const char* name, std::size_t bytes, double seconds, double max_probe_us) {
+    std::cout << std::left << std::setw(28) << name
+              << std::right << std::setw(10) << std::fixed << std::setprecision(1)
+              << bytes / seconds / (1 << 20) << " MB/s"
+              << "   worst pool task wait: " << std::setprecision(0) << max_probe_us << " us\n";
+}
+
+// 1) Her pool işi kendi parçasını blocking pread ile okur.
+void read_blocking_on_pool(WorkerPool& pool, int fd, std::size_t file_size) {
+    drop_cache(fd);
+    LatencyProbe probe(pool);
+    auto t1 = steady_clock::now();
+
+    std::vector<std::future<void>> parts;
+    for (std::size_t off = 0; off < file_size; off += CHUNK) {
+        parts.push_back(pool.submit([fd, off] {
+            std::vector<char> buf(CHUNK);
+            ssize_t r = pread(fd, buf.data(), CHUNK, off);
+            if (r < 0) {
+                perror("pread");
+            } else if (static_cast<std::size_t>(r) < CHUNK) {
+                std::cerr << "short pread at " << off << ": " << r << " bytes\n";
+            }
+        }));
+    }
+    for (auto& p : parts) {
+        p.get();
+    }
+
+    double s = duration<double>(steady_clock::now() - t1).count();
+    report("blocking pread on pool", file_size, s, probe.stop_and_get_max_us());
+}
+
+// 2/3) AsyncFileIO ile QUEUE_DEPTH kadar istek uçuşta tutulur. Her tamamlanan
+// okuma callback'i pool üzerinde çalışır ve sıradaki parçayı gönderir.
+void read_async(WorkerPool& pool, AsyncFileIO& io, int fd, std::size_t file_size, const char* name) {
+    drop_cache(fd);
+    LatencyProbe probe(pool);
+    auto t1 = steady_clock::now();
+
+    std::vector<std::vector<char>> buffers(QUEUE_DEPTH, std::vector<char>(CHUNK));
+    std::atomic<std::size_t> next_offset{0};
+    std::atomic<std::size_t> remaining{(file_size + CHUNK - 1) / CHUNK};
+    std::promise<void> done;
+
+    std::function<void(std::size_t)> issue = [&](std::size_t slot) {
+        std::size_t off = next_offset.fetch_add(CHUNK);
+        if (off >= file_size) {
+            return;
+        }
+        io.read(fd, buffers[slot].data(), CHUNK, off, [&, slot, off](ssize_t r) {
+            // Dosya CHUNK'ın katı; her parça tam okunmalı.
+            if (r < 0) {
+                std::cerr << "read failed: " << std::strerror(-r) << "\n";
+            } else if (static_cast<std::size_t>(r) < CHUNK) {
+                std::cerr << "short read at " << off << ": " << r << " bytes\n";
+            }
+            issue(slot);
+            if (remaining.fetch_sub(1) == 1) {
+                done.set_value();
+            }
+        });
+    };
+    for (std::size_t slot = 0; slot < QUEUE_DEPTH; slot++) {
+        issue(slot);
+    }
+    done.get_future().wait();
+
+    double s = duration<double>(steady_clock::now() - t1).count();
+    report(name, file_size, s, probe.stop_and_get_max_us());
+}
+
+// Fiber modunda eski usul sıralı bir okuma döngüsü: kod blocking gibi yazılır,
+// read_wait ise sadece fiber'ı park eder.
+std::size_t checksum_with_fiber(AsyncFileIO& io, int fd, std::size_t file_size) {
+    std::vector<unsigned char> buf(CHUNK);
+    std::size_t sum = 0;
+    for (std::size_t off = 0; off < file_size; off += CHUNK) {
+        ssize_t r = io.read_wait(fd, buf.data(), CHUNK, off);
+        for (ssize_t i = 0; i < r; i += 4093) {
+            sum += buf[i];
+        }
+    }
+    return sum;
+}
+
+// co_await için en basit coroutine tipi: başlar, sonucu promise'e yazar.
+struct DetachedTask {
+    struct promise_type {
+        DetachedTask get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+DetachedTask checksum_with_coroutine(AsyncFileIO& io, int fd, std::size_t file_size,
+                                     std::promise<std::size_t>& result) {
+    std::vector<unsigned char> buf(CHUNK);
+    std::size_t sum = 0;
+    for (std::size_t off = 0; off < file_size; off += CHUNK) {
+        ssize_t r = co_await io.read_async(fd, buf.data(), CHUNK, off);
+        for (ssize_t i = 0; i < r; i += 4093) {
+            sum += buf[i];
+        }
+    }
+    result.set_value(sum);
+}
+
+int main(int argc, char** argv) {
+    std::size_t size_mb = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 512;
+    std::string path = argc > 2 ? argv[2] : "async_io_benchmark.dat";
+    std::size_t file_size = size_mb * CHUNK;
+
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        perror("open");
+        return 1;
+    }
+
+    WorkerPool pool(4);
+
+    std::cout << "--- writing " << size_mb << " MB test file ---\n";
+    {
+        AsyncFileIO io(pool);
+        std::vector<char> pattern(CHUNK);
+        for (std::size_t i = 0; i < CHUNK; i++) {
+            pattern[i] = static_cast<char>(i * 31);
+        }
+        auto t1 = steady_clock::now();
+        std::vector<std::future<ssize_t>> writes;
+        for (std::size_t off = 0; off < file_size; off += CHUNK) {
+            writes.push_back(io.write(fd, pattern.data(), CHUNK, off));
+            if (writes.size() == QUEUE_DEPTH) {
+                for (auto& w : writes) w.get();
+                writes.clear();
+            }
+        }
+        for (auto& w : writes) w.get();
+        fdatasync(fd);
+        double s = duration<double>(steady_clock::now() - t1).count();
+        report(io.backend() == AsyncFileIO::Backend::IoUring ? "write (io_uring)" : "write (threads)",
+               file_size, s, 0);
+    }
+
+    std::cout << "\n--- sequential read, " << CHUNK / 1024 << " KB chunks ---\n";
+    read_blocking_on_pool(pool, fd, file_size);
+    {
+        AsyncFileIO io(pool, AsyncFileIO::Backend::IoUring);
+        if (io.backend() == AsyncFileIO::Backend::IoUring) {
+            read_async(pool, io, fd, file_size, "AsyncFileIO (io_uring)");
+        } else {
+            std::cout << "io_uring is not available here, skipping\n";
+        }
+    }
+    {
+        AsyncFileIO io(pool, AsyncFileIO::Backend::Threads);
+        read_async(pool, io, fd, file_size, "AsyncFileIO (I/O threads)");
+    }
+
+    std::cout << "\n--- fiber and coroutine readers ---\n";
+    {
+        WorkerPool fiber_pool(2, WorkerPool::Mode::Fibers);
+        AsyncFileIO io(fiber_pool);
+        auto a = fiber_pool.submit([&] { return checksum_with_fiber(io, fd, file_size); });
+
+        std::promise<std::size_t> b;
+        checksum_with_coroutine(io, fd, file_size, b);
+
+        std::size_t fa = a.get();
+        std::size_t fb = b.get_future().get();
+        std::cout << "fiber checksum: " << fa << ", coroutine checksum: " << fb
+                  << (fa == fb ? " (match)\n" : " (MISMATCH)\n");
+    }
+
+    close(fd);
+    unlink(path.c_str());
+    return 0;
+}
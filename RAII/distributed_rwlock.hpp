@@ -0,0 +1,135 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+/*
+ * DistributedRWLock
+ * std::shared_mutex'te her lock_shared() aynı sayacı artırır. Okuma ne kadar
+ * kısa olursa olsun, bütün okuyucular o tek cache line'ı sırayla exclusive
+ * almak zorunda; okuyucu sayısı arttıkça okuma hızlanmak yerine yavaşlar.
+ *
+ * Burada her okuyucu thread kendi slotundaki sayacı artırır. Slotlar ayrı
+ * cache line'larda (128 byte, adjacent-line prefetch için) durduğu için
+ * okuyucular birbirinin line'ına dokunmaz. Bedeli yazar öder: lock()
+ * önce writer_ bayrağını kaldırır, sonra bütün slotları tarayıp okuyucuların
+ * çıkmasını bekler. Okuma ağırlıklı (read-mostly) yapılar için uygundur;
+ * sık yazılan bir yapıda std::shared_mutex daha iyidir.
+ *
+ * Okuyucu:  slot++ → writer_ var mı? → yoksa gir
+ *                                      varsa slot--, writer_ bitene kadar bekle
+ * Yazar:    writer_ = true → bütün slotlar 0 olana kadar bekle
+ *
+ * İki taraf da önce kendi değişkenine yazıp sonra karşı tarafınkini okur
+ * (Dekker). Bu sıranın korunması için bu işlemler seq_cst'dir; x86'da RMW
+ * komutları zaten tam bariyerdir.
+ *
+ * Yazar geldiğinde yeni okuyucular geri çekilir, yazar aç kalmaz.
+ *
+ * SharedLockable'dır: std::shared_lock ile okuma, std::unique_lock /
+ * std::lock_guard ile yazma yapılır.
+ *
+ * Thread'ler slotlara ilk kullanımda sırayla (round-robin) dağıtılır.
+ * Slot sayısından fazla okuyucu thread varsa bazı thread'ler aynı slotu
+ * paylaşır; doğruluk bozulmaz, sadece o slotta yarışma olur.
+ */
+class DistributedRWLock {
+public:
+    explicit DistributedRWLock(std::size_t slots = default_slots())
+        : slots_(slots == 0 ? 1 : slots) {}
+
+    DistributedRWLock(const DistributedRWLock&) = delete;
+    DistributedRWLock& operator=(const DistributedRWLock&) = delete;
+
+    // ---- okuma ----
+    void lock_shared() {
+        Slot& s = my_slot();
+        while (true) {
+            s.readers.fetch_add(1, std::memory_order_seq_cst);
+            if (!writer_.load(std::memory_order_seq_cst)) {
+                return;
+            }
+            s.readers.fetch_sub(1, std::memory_order_release);
+            spin_while([this] { return writer_.load(std::memory_order_relaxed); });
+        }
+    }
+
+    bool try_lock_shared() {
+        Slot& s = my_slot();
+        s.readers.fetch_add(1, std::memory_order_seq_cst);
+        if (!writer_.load(std::memory_order_seq_cst)) {
+            return true;
+        }
+        s.readers.fetch_sub(1, std::memory_order_release);
+        return false;
+    }
+
+    void unlock_shared() { my_slot().readers.fetch_sub(1, std::memory_order_release); }
+
+    // ---- yazma ----
+    void lock() {
+        while (writer_.exchange(true, std::memory_order_seq_cst)) {
+            spin_while([this] { return writer_.load(std::memory_order_relaxed); });
+        }
+        for (Slot& s : slots_) {
+            spin_while([&s] { return s.readers.load(std::memory_order_seq_cst) != 0; });
+        }
+    }
+
+    bool try_lock() {
+        bool expected = false;
+        if (!writer_.compare_exchange_strong(expected, true, std::memory_order_seq_cst)) {
+            return false;
+        }
+        for (Slot& s : slots_) {
+            if (s.readers.load(std::memory_order_seq_cst) != 0) {
+                writer_.store(false, std::memory_order_release);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void unlock() { writer_.store(false, std::memory_order_release); }
+
+    std::size_t slot_count() const { return slots_.size(); }
+
+    static std::size_t default_slots() {
+        unsigned hw = std::thread::hardware_concurrency();
+        return hw == 0 ? 1 : hw;
+    }
+
+private:
+    struct alignas(128) Slot {
+        std::atomic<int> readers{0};
+    };
+
+    // Thread başına bir kez atanan numara; bütün DistributedRWLock'lar için
+    // aynıdır, her lock bunu kendi slot sayısına göre katlar.
+    static std::size_t thread_index() {
+        static std::atomic<std::size_t> next{0};
+        thread_local std::size_t index = next.fetch_add(1, std::memory_order_relaxed);
+        return index;
+    }
+
+    Slot& my_slot() { return slots_[thread_index() % slots_.size()]; }
+
+    // Kısa süre pause ile bekler, uzarsa CPU'yu bırakır: lock'u tutan thread
+    // preempt edildiyse onun çalışmasına izin verilir.
+    template <typename Pred>
+    static void spin_while(Pred pred) {
+        for (int i = 0; pred(); i++) {
+            if (i < 128) {
+#if defined(__x86_64__) || defined(__i386__)
+                __builtin_ia32_pause();
+#endif
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    alignas(128) std::atomic<bool> writer_{false};
+    std::vector<Slot> slots_;
+};
@@ -0,0 +1,457 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if !defined(__x86_64__) || defined(FIBER_USE_UCONTEXT)
+#include <ucontext.h>
+#define FIBER_UCONTEXT 1
+#endif
+
+/*
+ * Fiber (stackful coroutine)
+ *
+ * Coroutine'e çevrilemeyen, fonksiyonun ortasında bloklanan eski handler'lar
+ * için kullanıcı alanında (user-space) context switch yapan fiber'lar.
+ * Bir fiber bloklandığında OS thread'i uyumaz; fiber kendi stack'i ile
+ * birlikte kenara alınır ve worker başka bir işe geçer.
+ *
+ * - Context switch x86-64 üzerinde elle yazılmış assembly ile yapılır:
+ *   sadece callee-saved register'lar (rbx, rbp, r12-r15), MXCSR ve x87
+ *   control word kaydedilir. Syscall yoktur, birkaç nanosaniye sürer.
+ * - Diğer mimarilerde (veya -DFIBER_USE_UCONTEXT ile) ucontext kullanılır.
+ *   swapcontext her seferinde sigprocmask syscall'u yaptığı için çok daha yavaştır.
+ * - Stack'ler mmap ile ayrılır, en altında PROT_NONE bir guard page bulunur.
+ *   Stack taşarsa sessizce başka bir belleği ezmek yerine SIGSEGV alınır.
+ *   Biten fiber'ların stack'leri FiberStackPool içinde tekrar kullanılır.
+ * - FiberMutex / FiberConditionVariable: fiber içinden çağrılırsa fiber'ı
+ *   park eder, normal bir thread'den çağrılırsa thread'i bloklar.
+ *
+ * Fiber'ı çalıştıran zamanlayıcı (WorkerPool) FiberScheduler arayüzünü
+ * implemente eder.
+ */
+
+struct Fiber;
+
+// ---------------------------------------------------------------------
+//  Context switch
+// ---------------------------------------------------------------------
+
+#ifdef FIBER_UCONTEXT
+
+struct FiberContext {
+    ucontext_t uc;
+};
+
+inline void fiber_ucontext_entry(unsigned hi, unsigned lo, unsigned fhi, unsigned flo) {
+    // makecontext sadece int argüman kabul ettiği için pointer'lar ikiye bölünür.
+    auto entry = reinterpret_cast<void (*)(void*)>((std::uintptr_t(fhi) << 32) | flo);
+    void* arg = reinterpret_cast<void*>((std::uintptr_t(hi) << 32) | lo);
+    entry(arg);
+}
+
+inline void fiber_init_context(FiberContext* ctx, void* stack_base, std::size_t stack_size,
+                               void (*entry)(void*), void* arg) {
+    getcontext(&ctx->uc);
+    ctx->uc.uc_stack.ss_sp = stack_base;
+    ctx->uc.uc_stack.ss_size = stack_size;
+    ctx->uc.uc_link = nullptr;
+    std::uintptr_t a = reinterpret_cast<std::uintptr_t>(arg);
+    std::uintptr_t f = reinterpret_cast<std::uintptr_t>(entry);
+    makecontext(&ctx->uc, reinterpret_cast<void (*)()>(fiber_ucontext_entry), 4,
+                unsigned(a >> 32), unsigned(a), unsigned(f >> 32), unsigned(f));
+}
+
+inline void fiber_switch(FiberContext* from, FiberContext* to) {
+    swapcontext(&from->uc, &to->uc);
+}
+
+#else
+
+// Sadece kaydedilmiş stack pointer tutulur, register'lar stack'in üstündedir.
+struct FiberContext {
+    void* sp = nullptr;
+};
+
+extern "C" void fiber_switch_asm(void** from_sp, void* to_sp);
+extern "C" void fiber_trampoline_asm();
+
+/*
+ * fiber_switch_asm(from_sp, to_sp)   rdi = from_sp, rsi = to_sp
+ *   Callee-saved register'lar mevcut stack'e push edilir, rsp *from_sp'ye
+ *   yazılır, to_sp'ye geçilir ve oradaki register'lar pop edilir.
+ *   Son ret, hedef fiber'ın kaldığı yere (veya ilk seferde trampoline'e) döner.
+ *
+ * fiber_trampoline_asm
+ *   Yeni fiber'ın ilk çalıştığı yer: r12 = arg, r13 = entry fonksiyonu.
+ *   Stack 16 byte'a hizalanır ve entry(arg) çağrılır. Entry asla geri dönmez.
+ *
+ * .weak → header birden fazla translation unit'e include edilirse linker
+ * tek bir kopyayı seçer.
+ */
+asm(R"(
+    .text
+    .weak fiber_switch_asm
+    .type fiber_switch_asm, @function
+fiber_switch_asm:
+    pushq %rbp
+    pushq %rbx
+    pushq %r12
+    pushq %r13
+    pushq %r14
+    pushq %r15
+    subq  $16, %rsp
+    stmxcsr 8(%rsp)
+    fnstcw  (%rsp)
+    movq  %rsp, (%rdi)
+    movq  %rsi, %rsp
+    fldcw   (%rsp)
+    ldmxcsr 8(%rsp)
+    addq  $16, %rsp
+    popq  %r15
+    popq  %r14
+    popq  %r13
+    popq  %r12
+    popq  %rbx
+    popq  %rbp
+    ret
+    .size fiber_switch_asm, .-fiber_switch_asm
+
+    .weak fiber_trampoline_asm
+    .type fiber_trampoline_asm, @function
+fiber_trampoline_asm:
+    movq  %r12, %rdi
+    andq  $-16, %rsp
+    callq *%r13
+    ud2
+    .size fiber_trampoline_asm, .-fiber_trampoline_asm
+)");
+
+inline void fiber_init_context(FiberContext* ctx, void* stack_base, std::size_t stack_size,
+                               void (*entry)(void*), void* arg) {
+    // Stack yukarıdan aşağı büyür. fiber_switch_asm'in pop edeceği
+    // başlangıç frame'i elle hazırlanır:
+    //   [0] x87 cw  [8] mxcsr  [16] r15  [24] r14  [32] r13  [40] r12
+    //   [48] rbx    [56] rbp   [64] dönüş adresi (trampoline)
+    auto top = reinterpret_cast<std::uintptr_t>(stack_base) + stack_size;
+    top &= ~std::uintptr_t(15);
+    auto* frame = reinterpret_cast<std::uint64_t*>(top - 10 * sizeof(std::uint64_t));
+
+    std::uint32_t mxcsr;
+    std::uint16_t fpucw;
+    asm volatile("stmxcsr %0" : "=m"(mxcsr));
+    asm volatile("fnstcw %0" : "=m"(fpucw));
+
+    frame[0] = fpucw;
+    frame[1] = mxcsr;
+    frame[2] = 0;                                         // r15
+    frame[3] = 0;                                         // r14
+    frame[4] = reinterpret_cast<std::uint64_t>(entry);   // r13
+    frame[5] = reinterpret_cast<std::uint64_t>(arg);     // r12
+    frame[6] = 0;                                         // rbx
+    frame[7] = 0;                                         // rbp
+    frame[8] = reinterpret_cast<std::uint64_t>(&fiber_trampoline_asm);
+    frame[9] = 0;
+    ctx->sp = frame;
+}
+
+inline void fiber_switch(FiberContext* from, FiberContext* to) {
+    fiber_switch_asm(&from->sp, to->sp);
+}
+
+#endif
+
+// ---------------------------------------------------------------------
+//  Stack havuzu
+// ---------------------------------------------------------------------
+
+struct FiberStack {
+    void* base = nullptr;      // kullanılabilir alanın başı (guard page'in hemen üstü)
+    std::size_t size = 0;      // guard page hariç boyut
+};
+
+/*
+ * FiberStackPool
+ * mmap/munmap her fiber için çağrılırsa syscall ve page fault maliyeti
+ * fiber'ın kendisinden pahalı olur. Bu yüzden biten fiber'ların stack'leri
+ * burada saklanır ve yeniden kullanılır. Destructor hepsini geri verir.
+ */
+class FiberStackPool {
+public:
+    explicit FiberStackPool(std::size_t stack_size)
+        : page_(static_cast<std::size_t>(sysconf(_SC_PAGESIZE))),
+          stack_size_((stack_size + page_ - 1) / page_ * page_) {}
+
+    ~FiberStackPool() {
+        for (FiberStack& s : free_) {
+            munmap(static_cast<char*>(s.base) - page_, s.size + page_);
+        }
+    }
+
+    FiberStackPool(const FiberStackPool&) = delete;
+    FiberStackPool& operator=(const FiberStackPool&) = delete;
+
+    FiberStack acquire() {
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            if (!free_.empty()) {
+                FiberStack s = free_.back();
+                free_.pop_back();
+                return s;
+            }
+        }
+        void* mem = mmap(nullptr, stack_size_ + page_, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+        if (mem == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        // En alttaki sayfa guard page: stack taşması burada SIGSEGV verir.
+        // Korunamazsa taşma sessizce komşu mapping'i bozar; stack verilmez.
+        // (mprotect genelde ENOMEM ile, mapping sayısı sınırında düşer.)
+        if (mprotect(mem, page_, PROT_NONE) != 0) {
+            munmap(mem, stack_size_ + page_);
+            throw std::bad_alloc();
+        }
+        return FiberStack{static_cast<char*>(mem) + page_, stack_size_};
+    }
+
+    void release(FiberStack s) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        free_.push_back(s);
+    }
+
+private:
+    std::size_t page_;
+    std::size_t stack_size_;
+    std::mutex mtx_;
+    std::vector<FiberStack> free_;
+};
+
+// ---------------------------------------------------------------------
+//  Fiber ve zamanlayıcı arayüzü
+// ---------------------------------------------------------------------
+
+// Çok kısa kritik bölgeler için spinlock. Fiber park edilirken bu lock
+// tutulur ve fiber'dan çıkıldıktan sonra zamanlayıcı tarafından bırakılır.
+class FiberSpinLock {
+public:
+    void lock() {
+        while (flag_.exchange(true, std::memory_order_acquire)) {
+            while (flag_.load(std::memory_order_relaxed)) {
+#if defined(__x86_64__) || defined(__i386__)
+                __builtin_ia32_pause();
+#endif
+            }
+        }
+    }
+    void unlock() { flag_.store(false, std::memory_order_release); }
+
+private:
+    std::atomic<bool> flag_{false};
+};
+
+class FiberScheduler {
+public:
+    // Park edilmiş bir fiber tekrar çalışmaya hazır.
+    virtual void make_ready(Fiber* fiber) = 0;
+
+protected:
+    ~FiberScheduler() = default;
+};
+
+struct Fiber {
+    FiberContext ctx;
+    FiberStack stack;
+    std::function<void()> task;
+
+    FiberScheduler* scheduler = nullptr;
+    FiberContext* return_ctx = nullptr;   // park/bitiş anında dönülecek zamanlayıcı context'i
+    FiberSpinLock* park_lock = nullptr;   // switch sonrası zamanlayıcının bırakacağı lock
+    std::size_t home = 0;                 // fiber'ı çalıştıran worker
+    bool done = false;
+};
+
+inline thread_local Fiber* tls_current_fiber = nullptr;
+
+// Çağıran kod bir fiber içinde mi çalışıyor?
+inline Fiber* fiber_current() { return tls_current_fiber; }
+
+/*
+ * fiber_park() → mevcut fiber'ı durdurup zamanlayıcıya döner.
+ * lock, fiber tamamen switch edildikten sonra zamanlayıcı tarafından bırakılır.
+ * Böylece fiber'ı uyandıracak taraf, fiber hala kendi stack'inde çalışırken
+ * onu ikinci kez çalıştıramaz.
+ */
+inline void fiber_park(FiberSpinLock& lock) {
+    Fiber* self = tls_current_fiber;
+    self->park_lock = &lock;
+    fiber_switch(&self->ctx, self->return_ctx);
+}
+
+inline void fiber_wake(Fiber* fiber) {
+    fiber->scheduler->make_ready(fiber);
+}
+
+// Fiber'ın worker'ı diğer hazır işlere bırakıp kuyruğun sonuna geçmesi.
+inline void fiber_yield() {
+    Fiber* self = tls_current_fiber;
+    if (self == nullptr) {
+        return;
+    }
+    FiberSpinLock dummy;
+    dummy.lock();
+    self->scheduler->make_ready(self);
+    fiber_park(dummy);
+}
+
+// ---------------------------------------------------------------------
+//  Fiber-aware senkronizasyon
+// ---------------------------------------------------------------------
+
+/*
+ * FiberWaiter: bekleyen taraf ya bir fiber ya da sıradan bir thread'dir.
+ * Waiter nesnesi bekleyenin stack'inde yaşar.
+ */
+class FiberWaiter {
+public:
+    FiberWaiter() : fiber_(fiber_current()) {}
+
+    // guard tutulurken çağrılır, dönüşte guard bırakılmış olur.
+    void block(FiberSpinLock& guard) {
+        if (fiber_ != nullptr) {
+            fiber_park(guard);
+            return;
+        }
+        guard.unlock();
+        std::unique_lock<std::mutex> lock(mtx_);
+        cv_.wait(lock, [this] { return ready_; });
+    }
+
+    void notify() {
+        if (fiber_ != nullptr) {
+            // Bu çağrıdan sonra waiter nesnesine dokunulmamalı,
+            // fiber uyanıp stack'ini değiştirebilir.
+            fiber_wake(fiber_);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mtx_);
+        ready_ = true;
+        cv_.notify_one();
+    }
+
+private:
+    Fiber* fiber_;
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    bool ready_ = false;
+};
+
+/*
+ * FiberMutex
+ * Lockable'dır, yani std::lock_guard / std::unique_lock / std::scoped_lock
+ * ile kullanılabilir. Lock doluysa fiber park edilir ve worker başka işe
+ * geçer. unlock() sahipliği doğrudan sıradaki bekleyene devreder (handoff),
+ * bu yüzden uyanan bekleyen lock'u tekrar yarışarak almak zorunda kalmaz.
+ */
+class FiberMutex {
+public:
+    void lock() {
+        guard_.lock();
+        if (!locked_) {
+            locked_ = true;
+            guard_.unlock();
+            return;
+        }
+        FiberWaiter waiter;
+        waiters_.push_back(&waiter);
+        waiter.block(guard_);
+        // Buraya dönüldüğünde lock bize devredilmiştir.
+    }
+
+    bool try_lock() {
+        std::lock_guard<FiberSpinLock> lock(guard_);
+        if (locked_) {
+            return false;
+        }
+        locked_ = true;
+        return true;
+    }
+
+    void unlock() {
+        guard_.lock();
+        if (waiters_.empty()) {
+            locked_ = false;
+            guard_.unlock();
+            return;
+        }
+        FiberWaiter* next = waiters_.front();
+        waiters_.pop_front();
+        guard_.unlock();
+        next->notify();
+    }
+
+private:
+    FiberSpinLock guard_;
+    bool locked_ = false;
+    std::deque<FiberWaiter*> waiters_;
+};
+
+/*
+ * FiberConditionVariable
+ * std::condition_variable_any gibi kullanılır ama bekleyen fiber'ı park eder.
+ * Lock herhangi bir BasicLockable olabilir (genelde std::unique_lock<FiberMutex>).
+ */
+class FiberConditionVariable {
+public:
+    template <typename Lock>
+    void wait(Lock& lock) {
+        FiberWaiter waiter;
+        guard_.lock();
+        waiters_.push_back(&waiter);
+        lock.unlock();
+        waiter.block(guard_);
+        lock.lock();
+    }
+
+    template <typename Lock, typename Predicate>
+    void wait(Lock& lock, Predicate pred) {
+        while (!pred()) {
+            wait(lock);
+        }
+    }
+
+    void notify_one() {
+        guard_.lock();
+        if (waiters_.empty()) {
+            guard_.unlock();
+            return;
+        }
+        FiberWaiter* next = waiters_.front();
+        waiters_.pop_front();
+        guard_.unlock();
+        next->notify();
+    }
+
+    void notify_all() {
+        guard_.lock();
+        std::deque<FiberWaiter*> all;
+        all.swap(waiters_);
+        guard_.unlock();
+        for (FiberWaiter* w : all) {
+            w->notify();
+        }
+    }
+
+private:
+    FiberSpinLock guard_;
+    std::deque<FiberWaiter*> waiters_;
+};
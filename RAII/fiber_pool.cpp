@@ -0,0 +1,127 @@
+// WorkerPool'un fiber modu için örnekler.
+// Burada fonksiyonun ortasında bloklanan "eski usul" handler'ları
+// OS thread'ini bloklamadan çalıştırmayı deniyoruz.
+
+// g++ -std=c++20 -O2 -pthread fiber_pool.cpp -o fiber_pool
+// ucontext ile denemek için: -DFIBER_USE_UCONTEXT
+
+#include <iostream>
+#include <vector>
+#include <future>
+#include <queue>
+#include <mutex>
+#include <chrono>
+
+#include "worker_pool.hpp"
+
+// smart_producer_consumer.cpp içindeki SafeQueue'nun fiber versiyonu.
+// Tek fark std::mutex / std::condition_variable yerine fiber-aware
+// primitive'lerin kullanılması, handler kodunun geri kalanı aynı kalır.
+class FiberQueue {
+public:
+    void push(int item) {
+        {
+            std::lock_guard<FiberMutex> lock(mtx_);
+            queue_.push(item);
+        }
+        cv_.notify_one();
+    }
+
+    int pop() {
+        std::unique_lock<FiberMutex> lock(mtx_);
+        cv_.wait(lock, [this] { return !queue_.empty(); });
+        int item = queue_.front();
+        queue_.pop();
+        return item;
+    }
+
+private:
+    std::queue<int> queue_;
+    FiberMutex mtx_;
+    FiberConditionVariable cv_;
+};
+
+int main() {
+    using namespace std::chrono;
+
+    std::cout << "--- 1. More blocked handlers than threads ---\n";
+    {
+        // 2 thread üzerinde 200 tüketici handler çalışıyor ve hepsi pop()
+        // içinde bloklanıyor. Mode::Threads ile bu kod deadlock olurdu çünkü
+        // ilk iki tüketici iki thread'i de uyutur ve üretici hiç çalışamaz.
+        WorkerPool pool(2, WorkerPool::Mode::Fibers);
+        FiberQueue queue;
+
+        const int consumers = 200;
+        std::vector<std::future<int>> results;
+        for (int i = 0; i < consumers; i++) {
+            results.push_back(pool.submit([&queue] { return queue.pop(); }));
+        }
+        auto producer = pool.submit([&queue] {
+            for (int i = 1; i <= consumers; i++) {
+                queue.push(i);
+            }
+        });
+
+        producer.get();
+        long long total = 0;
+        for (auto& r : results) {
+            total += r.get();
+        }
+        std::cout << "Consumed sum: " << total
+                  << " (expected " << consumers * (consumers + 1) / 2 << ")\n";
+    }
+
+    std::cout << "\n--- 2. FiberMutex under contention ---\n";
+    {
+        // Kritik bölgenin içinde fiber_yield() çağırıyoruz, yani lock tutulurken
+        // fiber kasıtlı olarak worker'ı bırakıyor. Diğer fiber'lar lock'u
+        // beklerken OS thread'ini değil sadece kendilerini park eder.
+        WorkerPool pool(4, WorkerPool::Mode::Fibers);
+        FiberMutex mtx;
+        long long counter = 0;
+
+        std::vector<std::future<void>> results;
+        for (int i = 0; i < 64; i++) {
+            results.push_back(pool.submit([&] {
+                for (int k = 0; k < 1000; k++) {
+                    std::lock_guard<FiberMutex> lock(mtx);
+                    long long v = counter;
+                    if (k % 100 == 0) {
+                        fiber_yield();
+                    }
+                    counter = v + 1;
+                }
+            }));
+        }
+        for (auto& r : results) {
+            r.get();
+        }
+        std::cout << "Counter: " << counter << " (expected " << 64 * 1000 << ")\n";
+    }
+
+    std::cout << "\n--- 3. Context switch cost ---\n";
+    {
+        // Tek worker üzerinde iki fiber sürekli fiber_yield() ile
+        // birbirine geçiyor. Her yield bir park + bir resume demektir.
+        WorkerPool pool(1, WorkerPool::Mode::Fibers);
+        const int switches = 1000000;
+
+        auto t1 = high_resolution_clock::now();
+        auto a = pool.submit([] { for (int i = 0; i < switches; i++) fiber_yield(); });
+        auto b = pool.submit([] { for (int i = 0; i < switches; i++) fiber_yield(); });
+        a.get();
+        b.get();
+        auto t2 = high_resolution_clock::now();
+
+        double ns = duration<double, std::nano>(t2 - t1).count() / (2.0 * switches);
+        std::cout << "fiber_yield (park + resume): " << ns << " ns"
+#ifdef FIBER_UCONTEXT
+                  << " (ucontext)\n";
+#else
+                  << " (x86-64 asm)\n";
+#endif
+    }
+
+    return 0;
+}
@@ -0,0 +1,178 @@
+// locks.hpp'deki lock'lar ve std::mutex için yarışma (contention) benchmark'ı.
+//
+// Her thread döngüde: lock al → kritik bölge → bırak → biraz yerel iş.
+// Kritik bölge paylaşılan bir diziyi cs_len kez günceller, yani lock ile
+// birlikte korunan verinin cache line'ları da thread'ler arasında taşınır.
+// Her ölçüm DURATION boyunca koşar ve şunlar yazdırılır:
+//   Mops/s   → saniyede toplam kaç kritik bölge tamamlandı
+//   fairness → en az / en çok lock alan thread'in oranı (1.00 = eşit)
+//
+// Beklenen tablo:
+//   - 1 thread: en ucuz lock kazanır (TAS, TTAS); MCS ve futex biraz daha pahalı.
+//   - Kısa kritik bölge + çok thread: TAS çöker, TTAS backoff ile toparlar,
+//     MCS en iyi ölçeklenen spin lock'tur. Ticket ve MCS adildir (~1.00).
+//   - Uzun kritik bölge: bekleme süresi baskın, spin yerine uyuyan
+//     std::mutex / FutexMutex CPU'yu boşa harcamaz.
+//   - Thread sayısı çekirdek sayısını geçince (oversubscription) ticket ve
+//     MCS çöker: sırası gelen thread uyuyorsa kimse ilerleyemez.
+//
+// g++ -std=c++20 -O2 -pthread lock_benchmark.cpp -o lock_benchmark
+// ./lock_benchmark [max_threads]
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <algorithm>
+#include <string>
+#include <sstream>
+#include <cstdlib>
+
+#include "locks.hpp"
+
+using namespace std::chrono;
+
+static_assert(Lockable<TasLock>);
+static_assert(Lockable<TtasLock>);
+static_assert(Lockable<TicketLock>);
+static_assert(Lockable<McsLock>);
+static_assert(Lockable<FutexMutex>);
+static_assert(Lockable<std::mutex>);
+
+constexpr milliseconds DURATION{100};
+constexpr int THINK = 64;   // lock dışındaki yerel iş (iterasyon)
+
+struct alignas(64) Shared {
+    std::uint64_t counter = 0;
+    std::uint64_t data[1024] = {};
+};
+
+struct alignas(64) PerThread {
+    std::uint64_t acquisitions = 0;
+};
+
+struct Result {
+    double mops;
+    double fairness;
+    bool ok;
+};
+
+template <typename L>
+Result run(int threads, int cs_len) {
+    L lock;
+    Shared shared;
+    std::vector<PerThread> counts(threads);
+    std::atomic<bool> start{false}, stop{false};
+
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; t++) {
+        pool.emplace_back([&, t] {
+            std::uint64_t local = t + 1, n = 0;
+            while (!start.load(std::memory_order_acquire)) {
+            }
+            while (!stop.load(std::memory_order_relaxed)) {
+                {
+                    std::lock_guard<L> guard(lock);
+                    shared.counter++;
+                    for (int i = 0; i < cs_len; i++) {
+                        shared.data[i & 1023] += local;
+                    }
+                }
+                n++;
+                for (int i = 0; i < THINK; i++) {
+                    local = local * 6364136223846793005ULL + 1442695040888963407ULL;
+                }
+            }
+            counts[t].acquisitions = n;
+            // local'i kullan ki derleyici döngüyü silmesin.
+            if (local == 0) shared.data[0]++;
+        });
+    }
+
+    auto t0 = steady_clock::now();
+    start.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(DURATION);
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& th : pool) {
+        th.join();
+    }
+    double secs = duration<double>(steady_clock::now() - t0).count();
+
+    std::uint64_t total = 0, lo = UINT64_MAX, hi = 0;
+    for (const PerThread& c : counts) {
+        total += c.acquisitions;
+        lo = std::min(lo, c.acquisitions);
+        hi = std::max(hi, c.acquisitions);
+    }
+    return {total / secs / 1e6, hi ? double(lo) / hi : 0.0, total == shared.counter};
+}
+
+struct Row {
+    int threads;
+    std::vector<Result> results;
+};
+
+template <typename... Locks>
+std::vector<Row> sweep(const std::vector<int>& thread_counts, int cs_len) {
+    std::vector<Row> rows;
+    for (int t : thread_counts) {
+        rows.push_back({t, {run<Locks>(t, cs_len)...}});
+    }
+    return rows;
+}
+
+int main(int argc, char** argv) {
+    const char* names[] = {"std::mutex", "TasLock", "TtasLock", "TicketLock", "McsLock", "FutexMutex"};
+    const int hw = std::max(1u, std::thread::hardware_concurrency());
+    const int max_threads = argc > 1 ? std::atoi(argv[1]) : std::max(4, 2 * hw);
+    if (max_threads < 1) {
+        std::cerr << "usage: " << argv[0] << " [max_threads >= 1]\n";
+        return 1;
+    }
+
+    // 1, 2, 4, ... ve 2'nin kuvveti değilse en sonda max_threads.
+    std::vector<int> thread_counts;
+    for (int t = 1; t <= max_threads; t *= 2) {
+        thread_counts.push_back(t);
+    }
+    if (thread_counts.back() != max_threads) {
+        thread_counts.push_back(max_threads);
+    }
+
+    // RAII guard'ları ile uyumluluk: scoped_lock farklı tipleri birlikte
+    // deadlock'suz kilitler (std::lock → try_lock kullanır).
+    {
+        TtasLock a;
+        McsLock b;
+        FutexMutex c;
+        std::scoped_lock all(a, b, c);
+        std::unique_lock<TicketLock> later;
+    }
+
+    std::cout << hw << " hardware threads, " << DURATION.count() << " ms per point, "
+              << "think time " << THINK << " iterations\n";
+
+    for (int cs_len : {0, 16, 128, 1024}) {
+        auto rows = sweep<std::mutex, TasLock, TtasLock, TicketLock, McsLock, FutexMutex>(thread_counts, cs_len);
+
+        std::cout << "\n=== critical section: " << cs_len << " shared updates ===\n";
+        std::cout << std::setw(8) << "threads";
+        for (const char* n : names) std::cout << std::setw(20) << n;
+        std::cout << "\n";
+        for (const Row& r : rows) {
+            std::cout << std::setw(8) << r.threads << (r.threads > hw ? "*" : " ");
+            for (const Result& res : r.results) {
+                std::string cell = (res.ok ? "" : "WRONG ");
+                std::ostringstream s;
+                s << std::fixed << std::setprecision(2) << res.mops << " (" << res.fairness << ")";
+                std::cout << std::setw(19) << cell + s.str() << " ";
+            }
+            std::cout << "\n";
+        }
+    }
+    std::cout << "\ncells: Mops/s (fairness = min/max per-thread acquisitions); "
+              << "* = more threads than hardware threads\n";
+}
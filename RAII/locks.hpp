@@ -0,0 +1,295 @@
+#pragma once
+#include <atomic>
+#include <climits>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/*
+ * Lock kütüphanesi
+ *
+ * RAII.cpp'deki std::mutex ve main.cpp'deki omp critical/atomic her zaman
+ * en iyi seçim değil. Buradaki lock'ların hepsi Lockable'dır (lock,
+ * try_lock, unlock), yani std::lock_guard, std::unique_lock ve
+ * std::scoped_lock ile std::mutex'in yerine doğrudan konabilir.
+ *
+ *   TasLock    → test-and-set: her deneme exchange yapar. Bekleyen her
+ *                thread lock'un cache line'ını sürekli exclusive ister,
+ *                line çekirdekler arasında gidip gelir.
+ *   TtasLock   → test-and-test-and-set: önce sadece okuyarak bekler (line
+ *                bütün bekleyenlerde shared kalır), boşalınca exchange
+ *                dener. Başarısız denemeden sonra üstel (exponential)
+ *                backoff ile yarışanlar dağıtılır.
+ *   TicketLock → sıra numarası: gelen next_'i artırır, serving_ kendi
+ *                numarasına gelene kadar bekler. FIFO, yani adil; ama
+ *                bütün bekleyenler aynı serving_'i okuduğu için her
+ *                unlock hepsinin line'ını invalid eder.
+ *   McsLock    → kuyruk lock'u: her bekleyen kendi düğümündeki bayrağı
+ *                okur, unlock sadece sıradakinin line'ına yazar. Çok
+ *                çekirdekte ölçeklenir, tek thread'de en pahalısı.
+ *   FutexMutex → kısa süre spin, sonra futex ile çekirdekte uyur. Bekleyen
+ *                yoksa unlock syscall yapmaz (Drepper, "Futexes Are Tricky").
+ *
+ * Spin lock'lar (ilk dördü) thread'ler çekirdek sayısından fazlaysa çok kötü
+ * davranır: lock'u tutan thread preempt edilirse bekleyenler bütün time
+ * slice'larını boşa döner. TicketLock ve McsLock'ta durum daha kötüdür,
+ * sıradaki thread uyuyorsa arkasındaki herkes onu bekler.
+ *
+ * Sadece Linux (futex syscall).
+ */
+
+template <typename L>
+concept Lockable = requires(L l) {
+    l.lock();
+    l.unlock();
+    { l.try_lock() } -> std::convertible_to<bool>;
+};
+
+inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+}
+
+class TasLock {
+public:
+    void lock() {
+        while (flag_.exchange(true, std::memory_order_acquire)) {
+            cpu_relax();
+        }
+    }
+    bool try_lock() { return !flag_.exchange(true, std::memory_order_acquire); }
+    void unlock() { flag_.store(false, std::memory_order_release); }
+
+private:
+    alignas(64) std::atomic<bool> flag_{false};
+};
+
+class TtasLock {
+public:
+    void lock() {
+        unsigned backoff = MIN_BACKOFF;
+        while (true) {
+            while (flag_.load(std::memory_order_relaxed)) {
+                cpu_relax();
+            }
+            if (!flag_.exchange(true, std::memory_order_acquire)) {
+                return;
+            }
+            // Başkası bizden önce aldı: bir süre line'a hiç dokunma.
+            for (unsigned i = 0; i < backoff; i++) {
+                cpu_relax();
+            }
+            backoff = backoff * 2 < MAX_BACKOFF ? backoff * 2 : MAX_BACKOFF;
+        }
+    }
+    bool try_lock() {
+        return !flag_.load(std::memory_order_relaxed) && !flag_.exchange(true, std::memory_order_acquire);
+    }
+    void unlock() { flag_.store(false, std::memory_order_release); }
+
+private:
+    static constexpr unsigned MIN_BACKOFF = 4;
+    static constexpr unsigned MAX_BACKOFF = 1024;   // pause sayısı
+    alignas(64) std::atomic<bool> flag_{false};
+};
+
+class TicketLock {
+public:
+    void lock() {
+        std::uint32_t ticket = next_.fetch_add(1, std::memory_order_relaxed);
+        while (true) {
+            std::uint32_t serving = serving_.load(std::memory_order_acquire);
+            if (serving == ticket) {
+                return;
+            }
+            // Önümüzdeki thread sayısı kadar bekle (proportional backoff):
+            // sıra bize gelmeden serving_'i tekrar tekrar okumanın anlamı yok.
+            for (std::uint32_t i = 0; i < (ticket - serving) * 16; i++) {
+                cpu_relax();
+            }
+        }
+    }
+    bool try_lock() {
+        std::uint32_t serving = serving_.load(std::memory_order_relaxed);
+        std::uint32_t expected = serving;
+        // Sadece kimse beklemiyorsa (next_ == serving_) bilet al.
+        return next_.compare_exchange_strong(expected, serving + 1, std::memory_order_acquire,
+                                             std::memory_order_relaxed);
+    }
+    void unlock() {
+        // serving_'e sadece lock sahibi yazar, fetch_add gerekmez.
+        serving_.store(serving_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+private:
+    // next_ ve serving_ ayrı line'larda: gelen thread'lerin fetch_add'i
+    // serving_'i bekleyenleri rahatsız etmesin.
+    alignas(64) std::atomic<std::uint32_t> next_{0};
+    alignas(64) std::atomic<std::uint32_t> serving_{0};
+};
+
+/*
+ * McsLock
+ * Her lock() çağrısı kuyruğa bir düğüm ekler ve sadece kendi düğümünün
+ * locked bayrağını okuyarak bekler. Lockable arayüzünde lock()/unlock()
+ * parametre almadığı için düğümler thread_local bir havuzdan alınır ve
+ * sahip olunan düğüm lock içinde (holder_) saklanır: holder_'a sadece lock
+ * sahibi dokunur. Bir thread aynı anda en fazla MCS_MAX_HELD McsLock
+ * tutabilir, fazlasında lock()/try_lock() std::system_error
+ * (resource_deadlock_would_occur) fırlatır; lock'lar herhangi bir sırada
+ * bırakılabilir.
+ */
+class McsLock {
+public:
+    static constexpr int MCS_MAX_HELD = 16;
+
+    void lock() {
+        Node* me = take_node();
+        me->next.store(nullptr, std::memory_order_relaxed);
+        me->locked.store(true, std::memory_order_relaxed);
+        Node* prev = tail_.exchange(me, std::memory_order_acq_rel);
+        if (prev) {
+            prev->next.store(me, std::memory_order_release);
+            while (me->locked.load(std::memory_order_acquire)) {
+                cpu_relax();
+            }
+        }
+        holder_ = me;
+    }
+
+    bool try_lock() {
+        Node* me = take_node();
+        me->next.store(nullptr, std::memory_order_relaxed);
+        Node* expected = nullptr;
+        if (tail_.compare_exchange_strong(expected, me, std::memory_order_acquire,
+                                          std::memory_order_relaxed)) {
+            holder_ = me;
+            return true;
+        }
+        give_node(me);
+        return false;
+    }
+
+    void unlock() {
+        Node* me = holder_;
+        Node* next = me->next.load(std::memory_order_acquire);
+        if (!next) {
+            Node* expected = me;
+            if (tail_.compare_exchange_strong(expected, nullptr, std::memory_order_release,
+                                              std::memory_order_relaxed)) {
+                give_node(me);
+                return;
+            }
+            // Birisi tail_'i aldı ama next'i henüz yazmadı.
+            while (!(next = me->next.load(std::memory_order_acquire))) {
+                cpu_relax();
+            }
+        }
+        next->locked.store(false, std::memory_order_release);
+        // Bu noktadan sonra düğümümüze kimse dokunmaz, tekrar kullanılabilir.
+        give_node(me);
+    }
+
+private:
+    struct alignas(64) Node {
+        std::atomic<Node*> next{nullptr};
+        std::atomic<bool> locked{false};
+    };
+
+    struct NodePool {
+        Node nodes[MCS_MAX_HELD];
+        Node* free[MCS_MAX_HELD];
+        int top = MCS_MAX_HELD;
+        NodePool() {
+            for (int i = 0; i < MCS_MAX_HELD; i++) free[i] = &nodes[i];
+        }
+    };
+
+    static NodePool& pool() {
+        thread_local NodePool p;
+        return p;
+    }
+    static Node* take_node() {
+        NodePool& p = pool();
+        // top == 0 ise thread zaten MCS_MAX_HELD lock tutuyor; havuzun
+        // dışına yazmak yerine std::mutex'in hata yolu gibi fırlatılır.
+        if (p.top == 0) {
+            throw std::system_error(std::make_error_code(std::errc::resource_deadlock_would_occur),
+                                    "McsLock: more than MCS_MAX_HELD locks held by one thread");
+        }
+        return p.free[--p.top];
+    }
+    static void give_node(Node* n) {
+        NodePool& p = pool();
+        p.free[p.top++] = n;
+    }
+
+    alignas(64) std::atomic<Node*> tail_{nullptr};
+    Node* holder_ = nullptr;
+};
+
+/*
+ * FutexMutex
+ * state_: 0 = boş, 1 = kilitli, 2 = kilitli ve bekleyen olabilir.
+ * Hızlı yol (yarışma yok) tek bir CAS ve tek bir exchange'dir, çekirdeğe
+ * hiç girilmez. Yarışmada önce SPIN_LIMIT kez spin yapılır; kritik bölge
+ * kısaysa lock bu sürede boşalır ve uyuma/uyanma maliyeti ödenmez.
+ */
+class FutexMutex {
+public:
+    void lock() {
+        int c = 0;
+        if (state_.compare_exchange_strong(c, 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return;
+        }
+        for (int i = 0; i < SPIN_LIMIT; i++) {
+            if (c == 0) {
+                if (state_.compare_exchange_strong(c, 1, std::memory_order_acquire,
+                                                   std::memory_order_relaxed)) {
+                    return;
+                }
+            } else {
+                cpu_relax();
+                c = state_.load(std::memory_order_relaxed);
+            }
+        }
+        // Uyumadan önce state 2 yapılır ki unlock bizi uyandırması gerektiğini
+        // bilsin. exchange 0 döndürürse lock'u almışızdır (2 ile, fazladan
+        // bir wake yapılabilir ama bu doğruluğu bozmaz).
+        if (c != 2) {
+            c = state_.exchange(2, std::memory_order_acquire);
+        }
+        while (c != 0) {
+            futex(FUTEX_WAIT_PRIVATE, 2);
+            c = state_.exchange(2, std::memory_order_acquire);
+        }
+    }
+
+    bool try_lock() {
+        int c = 0;
+        return state_.compare_exchange_strong(c, 1, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    void unlock() {
+        if (state_.exchange(0, std::memory_order_release) == 2) {
+            futex(FUTEX_WAKE_PRIVATE, 1);
+        }
+    }
+
+private:
+    static constexpr int SPIN_LIMIT = 100;
+
+    void futex(int op, int val) {
+        // std::atomic<int> ile int aynı boyut ve temsile sahip (lock-free).
+        syscall(SYS_futex, reinterpret_cast<int*>(&state_), op, val, nullptr, nullptr, 0);
+    }
+
+    static_assert(sizeof(std::atomic<int>) == sizeof(int) && std::atomic<int>::is_always_lock_free);
+    alignas(64) std::atomic<int> state_{0};
+};
@@ -0,0 +1,124 @@
+// WorkerPool öncelik sınıfları için karışık yük (mixed-load) benchmark'ı.
+//
+// Havuz arka plan compaction işleriyle doyuruluyor: her compaction işi
+// bitmeden önce kendi yerine yeni bir iş gönderiyor, yani kuyruklar hiç
+// boşalmıyor. Bu sırada dışarıdan her 2 ms'de bir acil "risk kontrolü"
+// gönderilip gönderilme anından çalışmaya başlamasına kadar geçen süre ölçülüyor.
+//
+//   1) Herkes Normal  → acil iş compaction'ların arkasına gömülür
+//   2) Acil = High, compaction = Low → acil iş sıradaki boş worker'da başlar
+//   3) High seli altında Low payı: 0 ve 0.1 ile Low kaç iş bitirebiliyor
+//
+// g++ -std=c++20 -O2 -pthread priority_benchmark.cpp -o priority_benchmark
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <future>
+
+#include "worker_pool.hpp"
+
+using namespace std::chrono;
+using Priority = WorkerPool::Priority;
+
+// sleep yerine CPU'yu gerçekten meşgul eden iş.
+void spin_for(microseconds d) {
+    auto end = steady_clock::now() + d;
+    while (steady_clock::now() < end) {
+    }
+}
+
+struct Background {
+    WorkerPool& pool;
+    Priority priority;
+    microseconds cost;
+    std::atomic<bool>& stop;
+    std::atomic<long>& completed;
+
+    void operator()() const {
+        // Yeni iş önce gönderilir: kendi deque'mizin arkasına düşer ve
+        // daha önce gönderilmiş acil işin üstüne biner.
+        if (!stop.load(std::memory_order_relaxed)) {
+            pool.submit(priority, *this);
+        }
+        spin_for(cost);
+        completed.fetch_add(1, std::memory_order_relaxed);
+    }
+};
+
+void print_latency(const char* name, std::vector<double>& us) {
+    std::sort(us.begin(), us.end());
+    auto pct = [&](double q) { return us[static_cast<std::size_t>(q * (us.size() - 1))]; };
+    std::cout << std::left << std::setw(34) << name << std::right << std::fixed << std::setprecision(0)
+              << "p50 " << std::setw(7) << pct(0.50) << " us   "
+              << "p99 " << std::setw(7) << pct(0.99) << " us   "
+              << "max " << std::setw(7) << us.back() << " us\n";
+}
+
+void urgent_latency(const char* name, Priority urgent, Priority background) {
+    const std::size_t threads = 4;
+    // Sayaçlar havuzdan önce tanımlanır: yerel değişkenler ters sırayla
+    // yok edilir, ~WorkerPool kuyruktaki Background işlerini bitirirken
+    // stop/completed hâlâ yaşıyor olmalı.
+    std::atomic<bool> stop{false};
+    std::atomic<long> completed{0};
+    WorkerPool pool(threads);
+
+    // Her worker başına birkaç kuyruk dolusu compaction.
+    for (std::size_t i = 0; i < threads * 8; i++) {
+        pool.submit(background, Background{pool, background, microseconds(500), stop, completed});
+    }
+    std::this_thread::sleep_for(milliseconds(20));
+
+    std::vector<std::future<double>> checks;
+    for (int i = 0; i < 300; i++) {
+        auto sent = steady_clock::now();
+        checks.push_back(pool.submit(urgent, [sent] {
+            double waited = duration<double, std::micro>(steady_clock::now() - sent).count();
+            spin_for(microseconds(20));
+            return waited;
+        }));
+        std::this_thread::sleep_for(milliseconds(2));
+    }
+
+    std::vector<double> us;
+    for (auto& c : checks) {
+        us.push_back(c.get());
+    }
+    stop = true;
+    print_latency(name, us);
+}
+
+long low_progress(double share) {
+    std::atomic<bool> stop{false};   // havuzdan önce, bkz. urgent_latency
+    std::atomic<long> high_done{0};
+    std::atomic<long> low_done{0};
+    WorkerPool pool(2);
+    pool.set_low_share(share);
+
+    for (int i = 0; i < 16; i++) {
+        pool.submit(Priority::High, Background{pool, Priority::High, microseconds(200), stop, high_done});
+        pool.submit(Priority::Low, Background{pool, Priority::Low, microseconds(200), stop, low_done});
+    }
+    std::this_thread::sleep_for(milliseconds(500));
+    stop = true;
+    long result = low_done.load();
+    std::cout << "low share " << std::setw(4) << std::setprecision(2) << share
+              << " -> high tasks " << std::setw(6) << high_done.load()
+              << ", low tasks " << std::setw(6) << result << " in 500 ms\n";
+    return result;
+}
+
+int main() {
+    std::cout << "--- urgent task start latency under saturation ---\n";
+    urgent_latency("all Normal", Priority::Normal, Priority::Normal);
+    urgent_latency("urgent High / background Low", Priority::High, Priority::Low);
+
+    std::cout << "\n--- Low starvation under a High flood ---\n";
+    low_progress(0.0);
+    low_progress(0.1);
+    return 0;
+}
@@ -0,0 +1,176 @@
+// DistributedRWLock okuyucu ölçeklenmesi benchmark'ı.
+//
+// Okuma ağırlıklı bir enstrüman tablosu: okuyucu thread'ler rastgele
+// enstrümanların fiyat adımı (tick size) ve limitlerini okur, bir yazar
+// thread'i arada bir (WRITE_EVERY) bir enstrümanı günceller. Tablo
+// aynı iş için üç lock ile korunuyor:
+//   std::mutex               → okuyucular da sırayla girer
+//   std::shared_mutex        → okuyucular paralel girer ama hepsi aynı
+//                              sayaca yazar
+//   DistributedRWLock        → her okuyucu kendi slotuna yazar
+// Okumalar std::shared_lock, yazmalar std::unique_lock ile yapılır.
+//
+// Okuyucu başına hız (per reader) std::shared_mutex'te okuyucu sayısı
+// arttıkça düşer, DistributedRWLock'ta yaklaşık sabit kalmalıdır.
+// Ölçüm anlamlı olsun diye okuyucu + yazar <= çekirdek sayısı olmalı.
+//
+// g++ -std=c++20 -O2 -pthread rwlock_benchmark.cpp -o rwlock_benchmark
+// ./rwlock_benchmark [max_readers]
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+#include "distributed_rwlock.hpp"
+
+using namespace std::chrono;
+
+constexpr milliseconds DURATION{200};
+constexpr microseconds WRITE_EVERY{100};
+constexpr int INSTRUMENTS = 4096;
+
+struct Instrument {
+    std::int64_t tick_size;
+    std::int64_t lot_size;
+    std::int64_t price_band_low;
+    std::int64_t price_band_high;
+    std::uint64_t version;
+};
+
+// std::shared_lock ile kullanılabilsin diye okumayı da exclusive yapan sarmalayıcı.
+struct ExclusiveMutex : std::mutex {
+    void lock_shared() { lock(); }
+    void unlock_shared() { unlock(); }
+};
+
+struct alignas(64) ReaderStats {
+    std::uint64_t lookups = 0;
+    std::uint64_t checksum = 0;
+};
+
+struct Result {
+    double lookups_per_sec;
+    std::uint64_t writes;
+    bool consistent;
+};
+
+template <typename Lock>
+Result run(int readers) {
+    Lock lock;
+    std::vector<Instrument> table(INSTRUMENTS);
+    for (int i = 0; i < INSTRUMENTS; i++) {
+        table[i] = {1 + i % 5, 100, 1000 * i, 1000 * i + 999, 0};
+    }
+    std::vector<ReaderStats> stats(readers);
+    std::atomic<bool> start{false}, stop{false}, consistent{true};
+    std::uint64_t writes = 0;
+
+    std::thread writer([&] {
+        while (!start.load(std::memory_order_acquire)) {
+        }
+        std::uint64_t n = 0;
+        auto next = steady_clock::now();
+        while (!stop.load(std::memory_order_relaxed)) {
+            next += WRITE_EVERY;
+            while (steady_clock::now() < next && !stop.load(std::memory_order_relaxed)) {
+            }
+            std::unique_lock<Lock> guard(lock);
+            Instrument& ins = table[n % INSTRUMENTS];
+            ins.price_band_low += 1;
+            ins.price_band_high += 1;
+            ins.version++;
+            n++;
+        }
+        writes = n;
+    });
+
+    std::vector<std::thread> pool;
+    for (int r = 0; r < readers; r++) {
+        pool.emplace_back([&, r] {
+            std::uint64_t n = 0, sum = 0, rng = r * 0x9e3779b97f4a7c15ULL + 1;
+            bool ok = true;
+            while (!start.load(std::memory_order_acquire)) {
+            }
+            while (!stop.load(std::memory_order_relaxed)) {
+                rng = rng * 6364136223846793005ULL + 1442695040888963407ULL;
+                std::size_t idx = (rng >> 33) % INSTRUMENTS;
+                std::shared_lock<Lock> guard(lock);
+                const Instrument& ins = table[idx];
+                // Yazar bandı iki alanda birlikte kaydırır; lock doğru
+                // çalışıyorsa genişlik hep 999'dur.
+                ok &= ins.price_band_high - ins.price_band_low == 999;
+                sum += ins.tick_size + ins.lot_size + ins.version;
+                n++;
+            }
+            stats[r].lookups = n;
+            stats[r].checksum = sum;
+            if (!ok) consistent = false;
+        });
+    }
+
+    auto t0 = steady_clock::now();
+    start.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(DURATION);
+    stop.store(true, std::memory_order_relaxed);
+    writer.join();
+    for (auto& t : pool) {
+        t.join();
+    }
+    double secs = duration<double>(steady_clock::now() - t0).count();
+
+    Result res{0, writes, consistent.load()};
+    for (const ReaderStats& s : stats) {
+        res.lookups_per_sec += s.lookups / secs;
+    }
+    return res;
+}
+
+template <typename Lock>
+void row(const char* name, int readers) {
+    Result r = run<Lock>(readers);
+    std::cout << std::left << std::setw(20) << name << std::right << std::setw(8) << readers
+              << std::fixed << std::setprecision(2)
+              << std::setw(16) << r.lookups_per_sec / 1e6
+              << std::setw(14) << r.lookups_per_sec / readers / 1e6
+              << std::setw(10) << r.writes
+              << (r.consistent ? "" : "  INCONSISTENT") << "\n";
+}
+
+int main(int argc, char** argv) {
+    const int hw = std::max(1u, std::thread::hardware_concurrency());
+    const int max_readers = argc > 1 ? std::atoi(argv[1]) : std::max(1, hw - 1);
+    if (max_readers < 1) {
+        std::cerr << "usage: " << argv[0] << " [max_readers >= 1]\n";
+        return 1;
+    }
+
+    std::cout << hw << " hardware threads, " << INSTRUMENTS << " instruments, 1 writer every "
+              << WRITE_EVERY.count() << " us, " << DURATION.count() << " ms per point, "
+              << DistributedRWLock::default_slots() << " reader slots\n\n";
+    std::cout << std::left << std::setw(20) << "" << std::right << std::setw(8) << "readers"
+              << std::setw(16) << "Mlookups/s" << std::setw(14) << "per reader"
+              << std::setw(10) << "writes" << "\n";
+
+    std::vector<int> reader_counts;
+    for (int readers = 1; readers <= max_readers; readers *= 2) {
+        reader_counts.push_back(readers);
+    }
+    if (reader_counts.back() != max_readers) {
+        reader_counts.push_back(max_readers);
+    }
+
+    for (int readers : reader_counts) {
+        row<ExclusiveMutex>("std::mutex", readers);
+        row<std::shared_mutex>("std::shared_mutex", readers);
+        row<DistributedRWLock>("DistributedRWLock", readers);
+        std::cout << "\n";
+    }
+}
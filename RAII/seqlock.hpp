@@ -0,0 +1,118 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/*
+ * seqlock<T>
+ * Tek yazar, çok okuyucu için sürüm (sequence) numaralı lock.
+ *
+ * Yazar:    seq_ tek sayıya çıkar → veriyi yaz → seq_ çift sayıya çıkar
+ * Okuyucu:  seq_'i oku → veriyi kopyala → seq_'i tekrar oku
+ *           İki değer aynı ve çift ise kopya tutarlıdır, değilse tekrar dene.
+ *
+ * mutex veya shared_mutex'te okuyucu da lock'un cache line'ına YAZAR
+ * (sayaç artırma), bu yüzden okuyucu sayısı arttıkça o line çekirdekler
+ * arasında gidip gelir. Burada okuyucu hiçbir paylaşılan line'a yazmaz;
+ * line'lar bütün okuyucularda shared durumda kalır ve sadece yazar
+ * güncelleme yaptığında invalid edilir. atomic<shared_ptr<T>> ise her
+ * yazmada bellek ayırır ve okuyucular referans sayacına yazar.
+ *
+ * Yazar hiç beklemez; okuyucu yazma sırasında denk gelirse tekrar dener.
+ * Çok sık yazılan büyük T'lerde okuyucular aç kalabilir (starvation).
+ *
+ * Veri std::atomic<uint64_t> kelimeleri olarak tutulur ve relaxed
+ * load/store ile kopyalanır. Düz memcpy, yazarla aynı anda okunduğunda
+ * C++ bellek modelinde data race (tanımsız davranış) olurdu. Sıralama
+ * için Boehm'in "Can Seqlocks Get Along with Programming Language Memory
+ * Models?" makalesindeki fence'ler kullanılır. x86'da relaxed atomic
+ * load/store düz mov'dur, ek maliyet yoktur.
+ *
+ * Birden fazla yazar varsa write() çağrıları dışarıdan seri hale
+ * getirilmelidir (örn. yazarlar arasında bir mutex).
+ */
+template <typename T>
+class seqlock {
+    static_assert(std::is_trivially_copyable_v<T>, "seqlock<T> requires a trivially copyable T");
+    static_assert(std::is_default_constructible_v<T>, "read() returns a copy built from raw words");
+    static constexpr std::size_t WORDS = (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+public:
+    seqlock() : seqlock(T{}) {}
+
+    explicit seqlock(const T& init) { store_words(init); }
+
+    seqlock(const seqlock&) = delete;
+    seqlock& operator=(const seqlock&) = delete;
+
+    // Sadece tek yazar thread'i çağırmalı.
+    void write(const T& value) {
+        std::uint64_t s = seq_.load(std::memory_order_relaxed);
+        seq_.store(s + 1, std::memory_order_relaxed);
+        // Veri yazmaları tek sayılı seq_'ten önce görünmesin.
+        std::atomic_thread_fence(std::memory_order_release);
+        store_words(value);
+        seq_.store(s + 2, std::memory_order_release);
+    }
+
+    // Yazar mevcut değeri yerinde değiştirir: update([](T& v) { v.bid = ...; }).
+    // Yazar kendi yazdığını okuduğu için burada tekrar deneme gerekmez.
+    template <typename F>
+    void update(F f) {
+        T value = load_words();
+        f(value);
+        write(value);
+    }
+
+    // Tutarlı bir kopya döndürür, gerekirse tekrar dener.
+    T read() const {
+        T value;
+        while (!try_read(value)) {
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#endif
+        }
+        return value;
+    }
+
+    // Tek deneme: yazma sırasında denk gelindiyse false döner.
+    bool try_read(T& out) const {
+        std::uint64_t s0 = seq_.load(std::memory_order_acquire);
+        if (s0 & 1) {
+            return false;
+        }
+        out = load_words();
+        // Veri okumaları ikinci seq_ okumasından sonraya kaymasın.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return seq_.load(std::memory_order_relaxed) == s0;
+    }
+
+    // Kaç güncelleme yapıldı (seq_ / 2).
+    std::uint64_t version() const { return seq_.load(std::memory_order_acquire) / 2; }
+
+private:
+    void store_words(const T& value) {
+        std::uint64_t buf[WORDS] = {};
+        std::memcpy(buf, &value, sizeof(T));
+        for (std::size_t i = 0; i < WORDS; i++) {
+            words_[i].store(buf[i], std::memory_order_relaxed);
+        }
+    }
+
+    T load_words() const {
+        std::uint64_t buf[WORDS];
+        for (std::size_t i = 0; i < WORDS; i++) {
+            buf[i] = words_[i].load(std::memory_order_relaxed);
+        }
+        T value;
+        std::memcpy(&value, buf, sizeof(T));
+        return value;
+    }
+
+    // seq_ ve verinin başı aynı cache line'da: küçük bir T için okuyucu
+    // tek line okur.
+    alignas(64) std::atomic<std::uint64_t> seq_{0};
+    std::atomic<std::uint64_t> words_[WORDS];
+};
@@ -0,0 +1,208 @@
+// seqlock<T> okuyucu ölçeklenmesi benchmark'ı.
+//
+// Bir yazar thread'i top-of-book snapshot'ını sürekli günceller, N okuyucu
+// thread'i olabildiğince hızlı okur. Aynı iş dört şekilde yapılıyor:
+//   std::mutex               → okuyucular da yazar gibi lock alır
+//   std::shared_mutex        → okuyucular shared lock alır ama hepsi aynı
+//                              sayaca yazar
+//   atomic<shared_ptr<T>>    → her yazma yeni bir nesne ayırır, okuyucular
+//                              referans sayacını artırıp azaltır
+//   seqlock<T>               → okuyucu hiçbir şeye yazmaz
+//
+// Her okumada snapshot'ın checksum'ı kontrol edilir; yırtık (torn) bir
+// okuma olursa "torn" sütununda görünür, 0 olmalıdır.
+//
+// Çekirdek sayısından fazla thread verilirse sonuçlar sadece time slicing'i
+// gösterir; anlamlı ölçüm için okuyucu + 1 <= çekirdek sayısı olmalı.
+//
+// g++ -std=c++20 -O2 -pthread seqlock_benchmark.cpp -o seqlock_benchmark
+// ./seqlock_benchmark [max_readers]
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <memory>
+#include <algorithm>
+#include <cstdlib>
+
+#include "seqlock.hpp"
+
+using namespace std::chrono;
+
+constexpr milliseconds DURATION{200};
+constexpr int WRITE_PAUSE = 200;   // iki güncelleme arası pause sayısı (~birkaç µs)
+
+struct TopOfBook {
+    std::int64_t bid_px;
+    std::int64_t ask_px;
+    std::int64_t bid_qty;
+    std::int64_t ask_qty;
+    std::uint64_t update_id;
+    std::uint64_t checksum;
+};
+
+static std::uint64_t checksum(const TopOfBook& b) {
+    return b.bid_px * 31 + b.ask_px * 37 + b.bid_qty * 41 + b.ask_qty * 43 + b.update_id;
+}
+
+static TopOfBook make_book(std::uint64_t id) {
+    TopOfBook b;
+    b.bid_px = 100000 + id % 97;
+    b.ask_px = b.bid_px + 1 + id % 3;
+    b.bid_qty = 100 + id % 1000;
+    b.ask_qty = 200 + id % 777;
+    b.update_id = id;
+    b.checksum = checksum(b);
+    return b;
+}
+
+struct MutexBox {
+    std::mutex mtx;
+    TopOfBook value = make_book(0);
+    void write(const TopOfBook& b) {
+        std::lock_guard<std::mutex> lock(mtx);
+        value = b;
+    }
+    TopOfBook read() {
+        std::lock_guard<std::mutex> lock(mtx);
+        return value;
+    }
+};
+
+struct SharedMutexBox {
+    std::shared_mutex mtx;
+    TopOfBook value = make_book(0);
+    void write(const TopOfBook& b) {
+        std::unique_lock<std::shared_mutex> lock(mtx);
+        value = b;
+    }
+    TopOfBook read() {
+        std::shared_lock<std::shared_mutex> lock(mtx);
+        return value;
+    }
+};
+
+struct AtomicSharedPtrBox {
+    std::atomic<std::shared_ptr<const TopOfBook>> ptr{std::make_shared<const TopOfBook>(make_book(0))};
+    void write(const TopOfBook& b) { ptr.store(std::make_shared<const TopOfBook>(b)); }
+    TopOfBook read() { return *ptr.load(); }
+};
+
+struct SeqlockBox {
+    seqlock<TopOfBook> lock{make_book(0)};
+    void write(const TopOfBook& b) { lock.write(b); }
+    TopOfBook read() { return lock.read(); }
+};
+
+struct alignas(64) ReaderStats {
+    std::uint64_t reads = 0;
+    std::uint64_t torn = 0;
+};
+
+struct Result {
+    double reads_per_sec;
+    double writes_per_sec;
+    std::uint64_t torn;
+};
+
+template <typename Box>
+Result run(int readers) {
+    Box box;
+    std::vector<ReaderStats> stats(readers);
+    std::atomic<bool> start{false}, stop{false};
+    std::uint64_t writes = 0;
+
+    std::thread writer([&] {
+        while (!start.load(std::memory_order_acquire)) {
+        }
+        std::uint64_t id = 1;
+        while (!stop.load(std::memory_order_relaxed)) {
+            box.write(make_book(id++));
+            for (int i = 0; i < WRITE_PAUSE; i++) {
+#if defined(__x86_64__) || defined(__i386__)
+                __builtin_ia32_pause();
+#endif
+            }
+        }
+        writes = id - 1;
+    });
+
+    std::vector<std::thread> pool;
+    for (int r = 0; r < readers; r++) {
+        pool.emplace_back([&, r] {
+            std::uint64_t n = 0, torn = 0;
+            while (!start.load(std::memory_order_acquire)) {
+            }
+            while (!stop.load(std::memory_order_relaxed)) {
+                TopOfBook b = box.read();
+                torn += b.checksum != checksum(b);
+                n++;
+            }
+            stats[r].reads = n;
+            stats[r].torn = torn;
+        });
+    }
+
+    auto t0 = steady_clock::now();
+    start.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(DURATION);
+    stop.store(true, std::memory_order_relaxed);
+    writer.join();
+    for (auto& t : pool) {
+        t.join();
+    }
+    double secs = duration<double>(steady_clock::now() - t0).count();
+
+    Result res{0, writes / secs, 0};
+    for (const ReaderStats& s : stats) {
+        res.reads_per_sec += s.reads / secs;
+        res.torn += s.torn;
+    }
+    return res;
+}
+
+template <typename Box>
+void row(const char* name, int readers) {
+    Result r = run<Box>(readers);
+    std::cout << std::left << std::setw(24) << name << std::right << std::setw(8) << readers
+              << std::fixed << std::setprecision(2)
+              << std::setw(14) << r.reads_per_sec / 1e6
+              << std::setw(14) << r.reads_per_sec / readers / 1e6
+              << std::setw(14) << r.writes_per_sec / 1e6
+              << std::setw(8) << r.torn << "\n";
+}
+
+int main(int argc, char** argv) {
+    const int hw = std::max(1u, std::thread::hardware_concurrency());
+    const int max_readers = argc > 1 ? std::atoi(argv[1]) : std::max(1, hw - 1);
+    if (max_readers < 1) {
+        std::cerr << "usage: " << argv[0] << " [max_readers >= 1]\n";
+        return 1;
+    }
+
+    std::cout << hw << " hardware threads, 1 writer, " << DURATION.count() << " ms per point\n\n";
+    std::cout << std::left << std::setw(24) << "" << std::right << std::setw(8) << "readers"
+              << std::setw(14) << "Mreads/s" << std::setw(14) << "per reader"
+              << std::setw(14) << "Mwrites/s" << std::setw(8) << "torn" << "\n";
+
+    std::vector<int> reader_counts;
+    for (int readers = 1; readers <= max_readers; readers *= 2) {
+        reader_counts.push_back(readers);
+    }
+    if (reader_counts.back() != max_readers) {
+        reader_counts.push_back(max_readers);
+    }
+
+    for (int readers : reader_counts) {
+        row<MutexBox>("std::mutex", readers);
+        row<SharedMutexBox>("std::shared_mutex", readers);
+        row<AtomicSharedPtrBox>("atomic<shared_ptr<T>>", readers);
+        row<SeqlockBox>("seqlock<T>", readers);
+        std::cout << "\n";
+    }
+}
@@ -1 +1,94 @@
-// Burada bir raii prensiplerine uygun bir workerpool implemente edicez
\ No newline at end of file
+// Burada bir raii prensiplerine uygun bir workerpool implemente edicez
+// Havuzun kendisi worker_pool.hpp içinde, burada ise kullanım örnekleri var.
+
+// g++ -std=c++20 -O2 -pthread worker_pool.cpp -o worker_pool
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <future>
+#include <atomic>
+#include <array>
+
+#include "worker_pool.hpp"
+
+// Burada her enstrümanın kendi state'i olduğunu düşünelim.
+// Bu state'e sadece tek bir worker dokunursa hem lock gerekmez hem de
+// veri o çekirdeğin L1/L2 cache'inde sıcak kalır.
+struct alignas(64) InstrumentState {
+    long long position = 0;
+    long long updates = 0;
+    int last_worker = -1;
+    bool migrated = false;
+};
+
+int main() {
+    WorkerPool pool(4);
+
+    std::cout << "--- 1. submit ---\n";
+    {
+        std::vector<std::future<int>> results;
+        for (int i = 0; i < 8; i++) {
+            results.push_back(pool.submit([i] { return i * i; }));
+        }
+        int total = 0;
+        for (auto& r : results) {
+            total += r.get();
+        }
+        std::cout << "Sum of squares: " << total << "\n";
+    }
+
+    std::cout << "\n--- 2. submit_to ---\n";
+    {
+        // Her iş doğrudan istenen worker'ın mailbox'ına gider ve
+        // başka bir worker tarafından çalınmaz.
+        std::vector<std::future<int>> results;
+        for (std::size_t w = 0; w < pool.size(); w++) {
+            results.push_back(pool.submit_to(w, [&pool] { return pool.current_worker(); }));
+        }
+        for (std::size_t w = 0; w < results.size(); w++) {
+            std::cout << "submit_to(" << w << ") ran on worker " << results[w].get() << "\n";
+        }
+    }
+
+    std::cout << "\n--- 3. submit_near ---\n";
+    {
+        // Aynı anahtara (enstrüman ismi) ait güncellemeler hep aynı
+        // worker'a düşer, bu yüzden InstrumentState lock olmadan güncellenebilir.
+        // Aynı anda arka planda sıradan işler de gönderiyoruz, bunlar havuz
+        // içinde dengelenir ama mailbox'lara dokunmaz.
+        const std::array<std::string, 4> symbols = {"AAPL", "MSFT", "GOOG", "TSLA"};
+        std::array<InstrumentState, 4> states{};
+        std::atomic<int> background{0};
+
+        std::vector<std::future<void>> results;
+        for (int i = 0; i < 4000; i++) {
+            std::size_t s = i % symbols.size();
+            results.push_back(pool.submit_near(symbols[s], [&pool, &states, s, i] {
+                InstrumentState& st = states[s];
+                int me = pool.current_worker();
+                if (st.last_worker != -1 && st.last_worker != me) {
+                    st.migrated = true;
+                }
+                st.last_worker = me;
+                st.position += (i % 2 == 0) ? 1 : -1;
+                st.updates++;
+            }));
+            results.push_back(pool.submit([&background] { background++; }));
+        }
+        for (auto& r : results) {
+            r.get();
+        }
+
+        for (std::size_t s = 0; s < symbols.size(); s++) {
+            std::cout << symbols[s] << " -> home worker " << pool.worker_for(symbols[s])
+                      << ", updates " << states[s].updates
+                      << ", position " << states[s].position
+                      << (states[s].migrated ? " (MIGRATED!)" : " (stayed on one worker)") << "\n";
+        }
+        std::cout << "Background tasks: " << background.load() << "\n";
+    }
+
+    // pool scope dışına çıkınca destructor bütün thread'leri join eder.
+    return 0;
+}
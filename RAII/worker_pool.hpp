@@ -0,0 +1,419 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "fiber.hpp"
+
+/*
+ * WorkerPool
+ * RAII prensiplerine uygun, work-stealing yapan bir thread havuzu.
+ *
+ * - Constructor thread'leri başlatır, destructor kuyruktaki tüm işleri
+ *   bitirip thread'leri join eder. Yani havuz scope dışına çıktığında
+ *   ortada sahipsiz bir thread kalmaz.
+ * - Her worker'ın kendine ait bir deque'su vardır. Worker kendi deque'sunun
+ *   arkasından (LIFO, cache sıcak) alır, boşta kalan worker'lar ise
+ *   diğerlerinin önünden (FIFO, en eski iş) çalar.
+ * - Her worker'ın ayrıca bir mailbox'ı vardır. submit_to / submit_near ile
+ *   gönderilen işler buraya düşer ve sıradan çalma (stealing) mailbox'a
+ *   dokunmaz. Böylece verisi bir çekirdeğin cache'inde sıcak duran işler
+ *   o çekirdekte kalır, geri kalan işler ise havuz içinde dengelenir.
+ * - İşler üç öncelik sınıfından birine girer (High, Normal, Low). Her sınıfın
+ *   kendi deque'ları vardır; worker'lar önce High'ı (kendi + çalma), sonra
+ *   Normal'i, en son Low'u boşaltır. Low'un tamamen aç kalmaması için
+ *   set_low_share() ile ayrılan pay kadar seçimde Low öne alınır.
+ * - Mode::Fibers ile her iş kendi stack'i olan bir fiber içinde çalışır.
+ *   Fiber FiberMutex / FiberConditionVariable üzerinde bloklanırsa OS thread'i
+ *   uyumaz, worker sıradaki işe geçer. Uyanan fiber kendi worker'ının ready
+ *   kuyruğuna döner (fiber thread değiştirmez, thread_local'lar güvenlidir).
+ *
+ * Derleme: g++ -std=c++20 -O2 -pthread worker_pool.cpp -o worker_pool
+ */
+class WorkerPool : private FiberScheduler {
+public:
+    using Task = std::function<void()>;
+
+    enum class Priority : std::size_t {
+        High = 0,     // acil işler (risk kontrolleri)
+        Normal = 1,
+        Low = 2       // arka plan işleri (compaction)
+    };
+    static constexpr std::size_t PRIORITY_COUNT = 3;
+
+    enum class Mode {
+        Threads,   // işler doğrudan worker thread'inin stack'inde çalışır
+        Fibers     // her iş pool'dan alınan bir fiber stack'inde çalışır
+    };
+
+    explicit WorkerPool(std::size_t thread_count = std::thread::hardware_concurrency(),
+                        Mode mode = Mode::Threads,
+                        std::size_t fiber_stack_size = 64 * 1024)
+        : workers_(thread_count == 0 ? 1 : thread_count),
+          mode_(mode),
+          stacks_(fiber_stack_size) {
+        threads_.reserve(workers_.size());
+        for (std::size_t i = 0; i < workers_.size(); i++) {
+            threads_.emplace_back(&WorkerPool::run, this, i);
+        }
+    }
+
+    // Destructor: önce kalan işlerin bitmesi beklenir, sonra thread'ler join edilir.
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mtx_);
+            stop_ = true;
+        }
+        sleep_cv_.notify_all();
+        for (auto& t : threads_) {
+            t.join();
+        }
+    }
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    std::size_t size() const { return workers_.size(); }
+
+    Mode mode() const { return mode_; }
+
+    /*
+     * set_low_share() → Low işlerin garanti edilen payı (0.0 - 1.0).
+     * Örneğin 0.1 ise Low kuyruğunda iş varken her 10 seçimden biri Low'dan
+     * yapılır, yüksek öncelikli işler havuzu sürekli doyursa bile.
+     * 0 verilirse katı öncelik uygulanır ve Low aç kalabilir. Varsayılan 0.05.
+     */
+    void set_low_share(double share) {
+        share = share < 0.0 ? 0.0 : (share > 1.0 ? 1.0 : share);
+        low_share_permille_.store(static_cast<unsigned>(share * 1000.0), std::memory_order_relaxed);
+    }
+
+    // Çağıran thread bu havuzun bir worker'ı ise onun index'i, değilse -1.
+    int current_worker() const {
+        return tls_pool_ == this ? tls_worker_ : -1;
+    }
+
+    /*
+     * submit() → sıradan iş (Priority::Normal).
+     * Havuz içinden çağrılırsa iş çağıran worker'ın deque'suna, dışarıdan
+     * çağrılırsa round-robin ile bir worker'ın deque'suna konur. Her iki
+     * durumda da boştaki worker'lar tarafından çalınabilir.
+     */
+    template <typename F>
+    auto submit(F&& f) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+        return submit(Priority::Normal, std::forward<F>(f));
+    }
+
+    template <typename F>
+    auto submit(Priority priority, F&& f) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+        auto [task, future] = package(std::forward<F>(f));
+        const std::size_t p = static_cast<std::size_t>(priority);
+        int self = current_worker();
+        std::size_t target = self >= 0
+            ? static_cast<std::size_t>(self)
+            : next_.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+        {
+            std::lock_guard<std::mutex> lock(workers_[target].mtx);
+            workers_[target].deques[p].push_back(std::move(task));
+            queued_[p].fetch_add(1, std::memory_order_relaxed);
+            stealable_.fetch_add(1, std::memory_order_release);
+        }
+        wake_one();
+        return std::move(future);
+    }
+
+    /*
+     * submit_to() → iş doğrudan worker_id'nin mailbox'ına konur ve
+     * sadece o worker tarafından çalıştırılır. worker_id >= size() ise
+     * std::out_of_range fırlatılır.
+     * Örneğin bir enstrümanın state'ine sadece tek bir worker dokunuyorsa
+     * bu state'in cache'te sıcak kalması ve lock gerektirmemesi sağlanır.
+     */
+    template <typename F>
+    auto submit_to(std::size_t worker_id, F&& f) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+        if (worker_id >= workers_.size()) {
+            throw std::out_of_range("WorkerPool::submit_to: worker_id out of range");
+        }
+        auto [task, future] = package(std::forward<F>(f));
+        Worker& w = workers_[worker_id];
+        {
+            std::lock_guard<std::mutex> lock(w.mtx);
+            w.mailbox.push_back(std::move(task));
+            w.pinned.fetch_add(1, std::memory_order_release);
+        }
+        wake_all();
+        return std::move(future);
+    }
+
+    /*
+     * submit_near() → hint_key'in hash'ine göre seçilen worker'ın mailbox'ına
+     * konur. Aynı anahtar her zaman aynı worker'a gider, bu yüzden anahtara
+     * ait state'e (örneğin bir enstrümanın pozisyonu) hep aynı çekirdek dokunur.
+     */
+    template <typename Key, typename F>
+    auto submit_near(const Key& hint_key, F&& f) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+        return submit_to(worker_for(hint_key), std::forward<F>(f));
+    }
+
+    // Bir anahtarın submit_near ile hangi worker'a gideceği.
+    template <typename Key>
+    std::size_t worker_for(const Key& hint_key) const {
+        // std::hash tam sayılar için genelde identity'dir, bu yüzden
+        // ardışık anahtarlar dağılsın diye bir karıştırma (mix) yapıyoruz.
+        std::uint64_t h = std::hash<Key>{}(hint_key);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return static_cast<std::size_t>(h % workers_.size());
+    }
+
+private:
+    // Her worker ayrı bir cache line'da durur, böylece bir worker'ın
+    // kuyruğuna yapılan push diğerinin kuyruğunu invalid etmez.
+    struct alignas(64) Worker {
+        std::mutex mtx;
+        std::deque<Task> deques[PRIORITY_COUNT];   // öncelik sınıfı başına çalınabilir işler
+        std::deque<Task> mailbox;        // affinity'li işler, sadece sahibi alır
+        std::deque<Fiber*> ready;        // uyanmış fiber'lar, sadece sahibi alır
+        std::atomic<std::size_t> pinned{0};   // mailbox + ready
+
+        // Aşağıdakilere sadece worker'ın kendi thread'i dokunur.
+        FiberContext sched_ctx;          // fiber'dan dönülen zamanlayıcı context'i
+        std::size_t live_fibers = 0;     // başlamış ama bitmemiş fiber sayısı
+        unsigned low_credit = 0;         // Low payı için biriken kredi (permille)
+    };
+
+    template <typename F>
+    static auto package(F&& f) {
+        using R = std::invoke_result_t<std::decay_t<F>>;
+        // packaged_task kopyalanamadığı için std::function içine
+        // shared_ptr ile sarılarak konur.
+        auto pt = std::make_shared<std::packaged_task<R()>>(std::forward<F>(f));
+        std::future<R> future = pt->get_future();
+        return std::pair<Task, std::future<R>>{[pt] { (*pt)(); }, std::move(future)};
+    }
+
+    /*
+     * try_pop() → worker'ın bir sonraki işi bulma sırası:
+     *   1) Kendi mailbox'ı (affinity'li işler önce)
+     *   2) Her öncelik sınıfı için sırayla (High → Normal → Low):
+     *        kendi deque'sunun arkası, sonra diğerlerinin önünden çalma
+     * Yani bir worker başka bir worker'dan High çalabilecekken kendi
+     * Normal işine geçmez. Low payı dolduğunda Low sınıfı en başa alınır.
+     * Mailbox'lar hiçbir zaman çalınmaz.
+     */
+    bool try_pop(std::size_t id, Task& out) {
+        Worker& self = workers_[id];
+        {
+            std::lock_guard<std::mutex> lock(self.mtx);
+            if (!self.mailbox.empty()) {
+                out = std::move(self.mailbox.front());
+                self.mailbox.pop_front();
+                self.pinned.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        const std::size_t low = static_cast<std::size_t>(Priority::Low);
+        const bool low_waiting = queued_[low].load(std::memory_order_relaxed) > 0;
+        if (!low_waiting) {
+            // Kredi biriktirilmez, Low boşken geçen süre sonradan patlama yaratmasın.
+            self.low_credit = 0;
+        } else if (self.low_credit >= 1000 && pop_class(id, low, out)) {
+            // Low seçimi de sayıma girer: her seçim payı kadar kredi getirir,
+            // Low seçimi 1000 harcar. Net -(1000 - pay); böylece döngü
+            // 1000 / pay seçimdir ve bunun biri Low'dur (0.1 → 10'da 1).
+            self.low_credit -= 1000 - low_share_permille_.load(std::memory_order_relaxed);
+            return true;
+        }
+
+        for (std::size_t p = 0; p < PRIORITY_COUNT; p++) {
+            if (queued_[p].load(std::memory_order_relaxed) == 0) {
+                continue;
+            }
+            if (pop_class(id, p, out)) {
+                if (p != low && low_waiting) {
+                    self.low_credit += low_share_permille_.load(std::memory_order_relaxed);
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool pop_class(std::size_t id, std::size_t p, Task& out) {
+        Worker& self = workers_[id];
+        {
+            std::lock_guard<std::mutex> lock(self.mtx);
+            if (!self.deques[p].empty()) {
+                out = std::move(self.deques[p].back());
+                self.deques[p].pop_back();
+                queued_[p].fetch_sub(1, std::memory_order_relaxed);
+                stealable_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        const std::size_t n = workers_.size();
+        for (std::size_t k = 1; k < n; k++) {
+            Worker& victim = workers_[(id + k) % n];
+            std::lock_guard<std::mutex> lock(victim.mtx);
+            if (!victim.deques[p].empty()) {
+                out = std::move(victim.deques[p].front());
+                victim.deques[p].pop_front();
+                queued_[p].fetch_sub(1, std::memory_order_relaxed);
+                stealable_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool has_work_for(std::size_t id) const {
+        return stealable_.load(std::memory_order_acquire) > 0 ||
+               workers_[id].pinned.load(std::memory_order_acquire) > 0;
+    }
+
+    Fiber* pop_ready(std::size_t id) {
+        Worker& self = workers_[id];
+        std::lock_guard<std::mutex> lock(self.mtx);
+        if (self.ready.empty()) {
+            return nullptr;
+        }
+        Fiber* f = self.ready.front();
+        self.ready.pop_front();
+        self.pinned.fetch_sub(1, std::memory_order_relaxed);
+        return f;
+    }
+
+    // FiberScheduler: park edilmiş fiber'ı kendi worker'ının ready kuyruğuna koyar.
+    void make_ready(Fiber* fiber) override {
+        Worker& w = workers_[fiber->home];
+        {
+            std::lock_guard<std::mutex> lock(w.mtx);
+            w.ready.push_back(fiber);
+            w.pinned.fetch_add(1, std::memory_order_release);
+        }
+        wake_all();
+    }
+
+    static void fiber_main(void* arg) {
+        Fiber* f = static_cast<Fiber*>(arg);
+        f->task();
+        f->task = nullptr;
+        f->done = true;
+        // Bu switch'ten sonra fiber'a bir daha dönülmez.
+        fiber_switch(&f->ctx, f->return_ctx);
+    }
+
+    void start_fiber(std::size_t id, Task&& task) {
+        Worker& w = workers_[id];
+        Fiber* f = new Fiber;
+        f->stack = stacks_.acquire();
+        f->task = std::move(task);
+        f->scheduler = this;
+        f->return_ctx = &w.sched_ctx;
+        f->home = id;
+        fiber_init_context(&f->ctx, f->stack.base, f->stack.size, &WorkerPool::fiber_main, f);
+        w.live_fibers++;
+        resume_fiber(id, f);
+    }
+
+    /*
+     * resume_fiber() → fiber'a geçilir ve fiber bitene ya da park edilene
+     * kadar buraya dönülmez. Park durumunda fiber'ın bıraktığı lock burada,
+     * yani fiber'ın stack'inden tamamen çıkıldıktan sonra açılır.
+     */
+    void resume_fiber(std::size_t id, Fiber* f) {
+        Worker& w = workers_[id];
+        tls_current_fiber = f;
+        fiber_switch(&w.sched_ctx, &f->ctx);
+        tls_current_fiber = nullptr;
+
+        if (f->done) {
+            stacks_.release(f->stack);
+            delete f;
+            w.live_fibers--;
+        } else if (f->park_lock != nullptr) {
+            FiberSpinLock* lock = f->park_lock;
+            f->park_lock = nullptr;
+            lock->unlock();
+        }
+    }
+
+    void run(std::size_t id) {
+        tls_pool_ = this;
+        tls_worker_ = static_cast<int>(id);
+
+        Task task;
+        while (true) {
+            // Uyanmış fiber'lar önce: genelde ellerinde bir lock vardır.
+            if (Fiber* f = pop_ready(id)) {
+                resume_fiber(id, f);
+                continue;
+            }
+            if (try_pop(id, task)) {
+                if (mode_ == Mode::Fibers) {
+                    start_fiber(id, std::move(task));
+                } else {
+                    task();
+                }
+                task = nullptr;
+                continue;
+            }
+            // Park edilmiş fiber'ı olan worker, stop_ gelse bile onlar
+            // bitene kadar çıkmaz.
+            std::size_t live = workers_[id].live_fibers;
+            std::unique_lock<std::mutex> lock(sleep_mtx_);
+            sleep_cv_.wait(lock, [&] { return (stop_ && live == 0) || has_work_for(id); });
+            if (stop_ && live == 0 && !has_work_for(id)) {
+                break;
+            }
+        }
+
+        tls_pool_ = nullptr;
+        tls_worker_ = -1;
+    }
+
+    // Uyuyan worker'ların wakeup'ı kaçırmaması için notify öncesi
+    // sleep_mtx_ kısa süreliğine alınır.
+    void wake_one() {
+        { std::lock_guard<std::mutex> lock(sleep_mtx_); }
+        sleep_cv_.notify_one();
+    }
+
+    // Pinned işler belirli bir worker'ı beklediği için herkes uyandırılır,
+    // doğru worker olmayanlar predicate'i kontrol edip tekrar uyur.
+    void wake_all() {
+        { std::lock_guard<std::mutex> lock(sleep_mtx_); }
+        sleep_cv_.notify_all();
+    }
+
+    std::vector<Worker> workers_;
+    std::vector<std::thread> threads_;
+
+    std::mutex sleep_mtx_;
+    std::condition_variable sleep_cv_;
+    bool stop_ = false;
+
+    std::atomic<std::size_t> stealable_{0};
+    std::atomic<std::size_t> queued_[PRIORITY_COUNT] = {};   // sınıf başına kuyruktaki iş
+    std::atomic<std::size_t> next_{0};
+    std::atomic<unsigned> low_share_permille_{50};   // varsayılan %5
+
+    Mode mode_;
+    FiberStackPool stacks_;
+
+    static inline thread_local const WorkerPool* tls_pool_ = nullptr;
+    static inline thread_local int tls_worker_ = -1;
+};